@@ -168,6 +168,9 @@ void Listview::populate()
     {{ "Zurich", "Mostly Cloudy", "23°C", "44%", "1023.7 mb" }}
   }};
 
+  // Sort and redraw only once after the last insertion
+  finalcut::FUpdateGuard update_guard{listview};
+
   for (const auto& place : weather)
   {
     const finalcut::FStringList line (place.cbegin(), place.cend());
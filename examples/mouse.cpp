@@ -505,12 +505,7 @@ void MouseDraw::drawCanvas()
                 , &canvaschar
                 , sizeof(finalcut::FChar) * unsigned(x_end) );
     auto& line_changes = printarea->changes[unsigned(ay + y)];
-
-    if ( int(line_changes.xmin) > ax )
-      line_changes.xmin = uInt(ax);
-
-    if ( int(line_changes.xmax) < ax + x_end - 1 )
-      line_changes.xmax = uInt(ax + x_end - 1);
+    line_changes.mark (uInt(ax), uInt(ax + x_end - 1));
   }
 
   printarea->has_changes = true;
@@ -51,13 +51,13 @@ struct Data
     const Termcap cap;
   };
 
-  static std::array<TermcapString, 86> strings;
+  static std::array<TermcapString, 90> strings;
 };
 
 //----------------------------------------------------------------------
 // struct data - string data array
 //----------------------------------------------------------------------
-std::array<Data::TermcapString, 86> Data::strings =
+std::array<Data::TermcapString, 90> Data::strings =
 {{
   { "t_bell", Termcap::t_bell },
   { "t_flash_screen", Termcap::t_flash_screen },
@@ -106,6 +106,10 @@ std::array<Data::TermcapString, 86> Data::strings =
   { "t_cursor_style", Termcap::t_cursor_style },
   { "t_scroll_forward", Termcap::t_scroll_forward },
   { "t_scroll_reverse", Termcap::t_scroll_reverse },
+  { "t_change_scroll_region", Termcap::t_change_scroll_region },
+  { "t_enter_lr_margin_mode", Termcap::t_enter_lr_margin_mode },
+  { "t_set_lr_margins", Termcap::t_set_lr_margins },
+  { "t_exit_lr_margin_mode", Termcap::t_exit_lr_margin_mode },
   { "t_enter_ca_mode", Termcap::t_enter_ca_mode },
   { "t_exit_ca_mode", Termcap::t_exit_ca_mode },
   { "t_enable_acs", Termcap::t_enable_acs },
@@ -22,6 +22,8 @@
 
 #include <unistd.h>
 
+#include <cerrno>
+#include <cstdint>
 #include <iostream>
 #include <thread>
 
@@ -30,10 +32,42 @@
 namespace finalcut
 {
 
+#if defined(USE_EPOLL_BACKEND)
+// The poll() event bits have the same values as the epoll event bits
+static_assert ( POLLIN == EPOLLIN && POLLPRI == EPOLLPRI
+             && POLLOUT == EPOLLOUT && POLLERR == EPOLLERR
+             && POLLHUP == EPOLLHUP
+              , "Incompatible poll and epoll event bits" );
+
+//----------------------------------------------------------------------
+static constexpr auto toEpollEvents (short events) -> uint32_t
+{
+  return uint32_t(uint16_t(events));
+}
+
+//----------------------------------------------------------------------
+static constexpr auto toPollEvents (uint32_t events) -> short
+{
+  return short(events & 0xffff);
+}
+#endif  // defined(USE_EPOLL_BACKEND)
+
+
 //----------------------------------------------------------------------
 // class EventLoop
 //----------------------------------------------------------------------
 
+// constructors and destructor
+//----------------------------------------------------------------------
+EventLoop::~EventLoop() noexcept  // destructor
+{
+#if defined(USE_EPOLL_BACKEND)
+  if ( epoll_fd != -1 )
+    ::close(epoll_fd);
+#endif
+}
+
+
 // public methods of EventLoop
 //----------------------------------------------------------------------
 auto EventLoop::run() -> int
@@ -49,6 +83,16 @@ auto EventLoop::run() -> int
   return 0;
 }
 
+//----------------------------------------------------------------------
+auto EventLoop::runOnce (int timeout) -> bool
+{
+  // Waits up to timeout milliseconds for monitor events and
+  // dispatches them. Returns false if no event has occurred.
+
+  running = true;
+  return processNextEvents(timeout);
+}
+
 
 // private methods of EventLoop
 //----------------------------------------------------------------------
@@ -59,23 +103,27 @@ inline void EventLoop::nonPollWaiting() const
 }
 
 //----------------------------------------------------------------------
-inline auto EventLoop::processNextEvents() -> bool
+inline auto EventLoop::processNextEvents (int timeout) -> bool
 {
-  nfds_t fd_count = 0;
   monitors_changed = false;
 
-  for (Monitor* monitor : monitors)
-  {
-    if ( monitor->isActive() )
-    {
-      fds[fd_count] = { monitor->getFileDescriptor(), monitor->getEvents(), 0 };
-      lookup_table[fd_count] = monitor;
-      fd_count++;
-    }
-
-    if ( fd_count >= MAX_MONITORS )
-      break;
-  }
+#if defined(USE_EPOLL_BACKEND)
+  if ( use_epoll )
+    return processEpollEvents(timeout);
+#endif
+
+  return processPollEvents(timeout);
+}
+
+//----------------------------------------------------------------------
+inline auto EventLoop::processPollEvents (int timeout) -> bool
+{
+  // Portable backend: waits with poll() on all active monitors
+
+  if ( poll_fds_outdated )
+    rebuildPollFds();
+
+  const auto fd_count = nfds_t(fds.size());
 
   if ( fd_count == 0 )
     return false;
@@ -84,7 +132,7 @@ inline auto EventLoop::processNextEvents() -> bool
 
   while ( true )
   {
-    poll_result = poll(fds.data(), fd_count, WAIT_INDEFINITELY);
+    poll_result = poll(fds.data(), fd_count, timeout);
 
     if ( poll_result != -1 || errno != EINTR )
       break;
@@ -98,6 +146,26 @@ inline auto EventLoop::processNextEvents() -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+void EventLoop::rebuildPollFds()
+{
+  // The pollfd array is only rebuilt after a monitor change
+
+  fds.clear();
+  lookup_table.clear();
+
+  for (Monitor* monitor : monitors)
+  {
+    if ( ! monitor->isActive() )
+      continue;
+
+    fds.push_back({ monitor->getFileDescriptor(), monitor->getEvents(), 0 });
+    lookup_table.push_back(monitor);
+  }
+
+  poll_fds_outdated = false;
+}
+
 //----------------------------------------------------------------------
 inline void EventLoop::dispatcher (int poll_result, nfds_t fd_count)
 {
@@ -127,6 +195,7 @@ void EventLoop::addMonitor (Monitor* monitor)
 {
   monitors.push_back(monitor);
   monitors_changed = true;
+  poll_fds_outdated = true;
 }
 
 //----------------------------------------------------------------------
@@ -134,6 +203,149 @@ void EventLoop::removeMonitor (Monitor* monitor)
 {
   monitors.remove(monitor);
   monitors_changed = true;
+  poll_fds_outdated = true;
+
+#if defined(USE_EPOLL_BACKEND)
+  const auto iter = registrations.find(monitor);
+
+  if ( iter != registrations.end() )
+  {
+    // The file descriptor may already be closed
+    ::epoll_ctl (epoll_fd, EPOLL_CTL_DEL, iter->second.fd, nullptr);
+    registrations.erase(iter);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+void EventLoop::updateMonitor (Monitor* monitor)
+{
+  // Called after a change of activity, file descriptor or events
+
+  poll_fds_outdated = true;
+
+#if defined(USE_EPOLL_BACKEND)
+  if ( use_epoll )
+    updateEpollRegistration(monitor);
+#endif
+}
+
+#if defined(USE_EPOLL_BACKEND)
+//----------------------------------------------------------------------
+auto EventLoop::initEpoll() -> bool
+{
+  if ( epoll_fd != -1 )
+    return true;
+
+  epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+  return epoll_fd != -1;
+}
+
+//----------------------------------------------------------------------
+inline auto EventLoop::processEpollEvents (int timeout) -> bool
+{
+  // Linux backend: the monitors stay registered in the epoll
+  // instance, so that no file descriptor list has to be built
+
+  if ( registrations.empty() )
+    return false;
+
+  int event_count{};
+
+  while ( true )
+  {
+    event_count = ::epoll_wait ( epoll_fd, epoll_events.data()
+                               , int(epoll_events.size()), timeout );
+
+    if ( event_count != -1 || errno != EINTR )
+      break;
+  }
+
+  if ( event_count <= 0 )
+    return false;
+
+  epollDispatcher(event_count);
+  return true;
+}
+
+//----------------------------------------------------------------------
+inline void EventLoop::epollDispatcher (int event_count)
+{
+  // Dispatching the ready events
+
+  for (int index{0}; index < event_count; index++)
+  {
+    const auto& event = epoll_events[std::size_t(index)];
+    auto monitor = static_cast<Monitor*>(event.data.ptr);
+    const auto return_events = toPollEvents(event.events);
+
+    if ( ! monitor->isActive() || ! (return_events & monitor->getEvents()) )
+      continue;
+
+    // Call the event handler for the monitor
+    monitor->trigger(return_events);
+
+    // A removed monitor can still be referenced by a later event.
+    // Unhandled events are reported again by the next epoll_wait().
+    if ( monitors_changed || ! running )
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void EventLoop::updateEpollRegistration (Monitor* monitor)
+{
+  const int fd = monitor->getFileDescriptor();
+  const short events = monitor->getEvents();
+  const bool monitored = monitor->isActive() && fd >= 0;
+  const auto iter = registrations.find(monitor);
+
+  if ( iter != registrations.end() )
+  {
+    if ( monitored
+      && iter->second.fd == fd
+      && iter->second.events == events )
+      return;  // Unchanged
+
+    ::epoll_ctl (epoll_fd, EPOLL_CTL_DEL, iter->second.fd, nullptr);
+    registrations.erase(iter);
+  }
+
+  if ( ! monitored )
+    return;
+
+  struct epoll_event event{};
+  event.events = toEpollEvents(events);
+  event.data.ptr = monitor;
+
+  if ( initEpoll()
+    && ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0 )
+  {
+    registrations[monitor] = { fd, events };
+    return;
+  }
+
+  // The file descriptor cannot be monitored with epoll (e.g. a regular
+  // file or a descriptor that is used by several monitors)
+  useEpollFallback();
+}
+
+//----------------------------------------------------------------------
+void EventLoop::useEpollFallback()
+{
+  // Switches permanently to the poll backend
+
+  if ( epoll_fd != -1 )
+  {
+    ::close(epoll_fd);
+    epoll_fd = -1;
+  }
+
+  registrations.clear();
+  use_epoll = false;
+  poll_fds_outdated = true;
+  monitors_changed = true;
 }
+#endif  // defined(USE_EPOLL_BACKEND)
 
 }  // namespace finalcut
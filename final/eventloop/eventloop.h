@@ -31,9 +31,17 @@
 #ifndef EVENTLOOP_H
 #define EVENTLOOP_H
 
-#include <list>
+#if defined(__linux__)
+  #define USE_EPOLL_BACKEND
+  #include <sys/epoll.h>
+#endif
+
 #include <poll.h>
+
 #include <array>
+#include <list>
+#include <unordered_map>
+#include <vector>
 
 #include "final/eventloop/monitor.h"
 #include "final/util/fstring.h"
@@ -48,34 +56,83 @@ namespace finalcut
 class EventLoop
 {
   public:
+    // Constant
+    static constexpr int WAIT_INDEFINITELY{-1};
+
     // Constructor
     EventLoop() = default;
 
+    // Disable copy constructor
+    EventLoop (const EventLoop&) = delete;
+
+    // Disable move constructor
+    EventLoop (EventLoop&&) noexcept = delete;
+
+    // Destructor
+    ~EventLoop() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const EventLoop&) -> EventLoop& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (EventLoop&&) noexcept -> EventLoop& = delete;
+
     // Accessor
     auto getClassName() const -> FString;
 
+    // Inquiry
+    auto isEpollBackend() const -> bool;
+
     // Methods
     auto run() -> int;
+    auto runOnce (int = WAIT_INDEFINITELY) -> bool;
     void leave();
 
   private:
-    // Constants
-    static constexpr nfds_t MAX_MONITORS{50};
-    static constexpr int WAIT_INDEFINITELY{-1};
-
     // Methods
     void nonPollWaiting() const;
-    auto processNextEvents() -> bool;
+    auto processNextEvents (int = WAIT_INDEFINITELY) -> bool;
+    auto processPollEvents (int) -> bool;
+    void rebuildPollFds();
     void dispatcher (int, nfds_t);
     void addMonitor (Monitor*);
     void removeMonitor (Monitor*);
+    void updateMonitor (Monitor*);
+
+#if defined(USE_EPOLL_BACKEND)
+    // Constant
+    static constexpr std::size_t MAX_EPOLL_EVENTS{64};
+
+    // Using-declaration
+    using EpollEvents = std::array<struct epoll_event, MAX_EPOLL_EVENTS>;
+
+    struct EpollRegistration
+    {
+      int   fd;
+      short events;
+    };
+
+    // Methods
+    auto initEpoll() -> bool;
+    auto processEpollEvents (int) -> bool;
+    void epollDispatcher (int);
+    void updateEpollRegistration (Monitor*);
+    void useEpollFallback();
+
+    // Data members
+    bool        use_epoll{true};
+    int         epoll_fd{-1};
+    EpollEvents epoll_events{};
+    std::unordered_map<Monitor*, EpollRegistration> registrations{};
+#endif  // defined(USE_EPOLL_BACKEND)
 
     // Data members
-    bool running{false};
-    bool monitors_changed{false};
-    std::list<Monitor*>  monitors{};
-    std::array<struct pollfd, MAX_MONITORS> fds{};
-    std::array<Monitor*, MAX_MONITORS>      lookup_table{};
+    bool                       running{false};
+    bool                       monitors_changed{false};
+    bool                       poll_fds_outdated{true};
+    std::list<Monitor*>        monitors{};
+    std::vector<struct pollfd> fds{};
+    std::vector<Monitor*>      lookup_table{};
 
     // Friend classes
     friend class Monitor;
@@ -86,6 +143,16 @@ class EventLoop
 inline auto EventLoop::getClassName() const -> FString
 { return "EventLoop"; }
 
+//----------------------------------------------------------------------
+inline auto EventLoop::isEpollBackend() const -> bool
+{
+#if defined(USE_EPOLL_BACKEND)
+  return use_epoll;
+#else
+  return false;
+#endif
+}
+
 //----------------------------------------------------------------------
 inline void EventLoop::leave()
 { running = false; }
@@ -52,4 +52,47 @@ Monitor::~Monitor()  // destructor
     eventloop->removeMonitor(this);
 }
 
+
+// public methods of Monitor
+//----------------------------------------------------------------------
+void Monitor::resume()
+{
+  active = true;
+  notifyEventLoop();
+}
+
+//----------------------------------------------------------------------
+void Monitor::suspend()
+{
+  active = false;
+  notifyEventLoop();
+}
+
+
+// protected methods of Monitor
+//----------------------------------------------------------------------
+void Monitor::setFileDescriptor (int file_descriptor)
+{
+  fd = file_descriptor;
+  notifyEventLoop();
+}
+
+//----------------------------------------------------------------------
+void Monitor::setEvents (short ev)
+{
+  events = ev;
+  notifyEventLoop();
+}
+
+
+// private methods of Monitor
+//----------------------------------------------------------------------
+inline void Monitor::notifyEventLoop()
+{
+  // Keeps the registration in the event loop up to date
+
+  if ( eventloop )
+    eventloop->updateMonitor(this);
+}
+
 }  // namespace finalcut
@@ -136,6 +136,9 @@ class Monitor
     // Using-declaration
     using FDataAccessPtr = std::shared_ptr<FDataAccess>;
 
+    // Method
+    void notifyEventLoop();
+
     // Data member
     bool           active{false};
     EventLoop*     eventloop{};
@@ -176,14 +179,6 @@ auto Monitor::getUserContext() const -> clean_fdata_t<T>&
 inline auto Monitor::isActive() const -> bool
 { return active; }
 
-//----------------------------------------------------------------------
-inline void Monitor::resume()
-{ active = true; }
-
-//----------------------------------------------------------------------
-inline void Monitor::suspend()
-{ active = false; }
-
 //----------------------------------------------------------------------
 inline void Monitor::trigger (short return_events)
 {
@@ -191,14 +186,6 @@ inline void Monitor::trigger (short return_events)
     handler (this, return_events);
 }
 
-//----------------------------------------------------------------------
-inline void Monitor::setFileDescriptor (int file_descriptor)
-{ fd = file_descriptor; }
-
-//----------------------------------------------------------------------
-inline void Monitor::setEvents (short ev)
-{ events = ev; }
-
 //----------------------------------------------------------------------
 inline void Monitor::setHandler (handler_t&& hdl)
 { handler = std::move(hdl); }
@@ -24,6 +24,11 @@
   #define _XOPEN_SOURCE 700
 #endif
 
+#if defined(__linux__)
+  #define USE_SIGNALFD
+  #include <sys/signalfd.h>
+#endif
+
 #include <unistd.h>
 
 #include <csignal>
@@ -59,6 +64,21 @@ static auto getSignalMonitorMap() -> SignalMonitorMap&
 }
 
 
+#if defined(USE_SIGNALFD)
+//----------------------------------------------------------------------
+static void drainSignalFd (int fd)
+{
+  // Reading all queued signals resets the readiness of the signalfd
+
+  struct signalfd_siginfo signal_info{};
+
+  while ( ::read(fd, &signal_info, sizeof(signal_info))
+          == ssize_t(sizeof(signal_info)) )
+    continue;
+}
+#endif  // defined(USE_SIGNALFD)
+
+
 //----------------------------------------------------------------------
 // class SignalMonitor::SigactionImpl
 //----------------------------------------------------------------------
@@ -72,10 +92,13 @@ class SignalMonitor::SigactionImpl
     // Accessors
     auto getSigaction() const -> const struct sigaction*;
     auto getSigaction() -> struct sigaction*;
+    auto getSigmask() const -> const sigset_t*;
+    auto getSigmask() -> sigset_t*;
 
   private:
     // Data members
     struct sigaction old_sig_action{};
+    sigset_t         old_sig_mask{};
 };
 
 // SignalMonitor::SigactionImpl inline functions
@@ -87,6 +110,14 @@ inline auto SignalMonitor::SigactionImpl::getSigaction() const -> const struct s
 inline auto SignalMonitor::SigactionImpl::getSigaction() -> struct sigaction*
 { return &old_sig_action; }
 
+//----------------------------------------------------------------------
+inline auto SignalMonitor::SigactionImpl::getSigmask() const -> const sigset_t*
+{ return &old_sig_mask; }
+
+//----------------------------------------------------------------------
+inline auto SignalMonitor::SigactionImpl::getSigmask() -> sigset_t*
+{ return &old_sig_mask; }
+
 
 //----------------------------------------------------------------------
 // class SignalMonitor
@@ -102,13 +133,23 @@ SignalMonitor::SignalMonitor (EventLoop* eloop)
 //----------------------------------------------------------------------
 SignalMonitor::~SignalMonitor() noexcept  // destructor
 {
-  // Restore original signal handling.
   static const auto& fsystem = FSystem::getInstance();
+
+#if defined(USE_SIGNALFD)
+  if ( isInitialized() )
+  {
+    // Close the signalfd and restore the signal mask
+    (void)fsystem->close(getFileDescriptor());
+    unblockSignal();
+  }
+#else
+  // Restore original signal handling.
   fsystem->sigaction (signal_number, getSigactionImpl()->getSigaction(), nullptr);
 
   // Close pipe file descriptors
   (void)fsystem->close(signal_pipe.getReadFd());
   (void)fsystem->close(signal_pipe.getWriteFd());
+#endif
 
   // Remove monitor instance from the assignment table.
   getSignalMonitorMap().erase(signal_number);
@@ -119,7 +160,11 @@ SignalMonitor::~SignalMonitor() noexcept  // destructor
 //----------------------------------------------------------------------
 void SignalMonitor::trigger (short return_events)
 {
+#if defined(USE_SIGNALFD)
+  drainSignalFd(getFileDescriptor());
+#else
   drainPipe(getFileDescriptor());
+#endif
   Monitor::trigger(return_events);
 }
 
@@ -157,8 +202,13 @@ void SignalMonitor::init()
   setEvents (POLLIN);
   handledAlarmSignal();
   ensureSignalIsUnmonitored();
+#if defined(USE_SIGNALFD)
+  blockSignal();
+  createSignalFd();
+#else
   createPipe();
   installSignalHandler();
+#endif
   enterMonitorInstanceInTable();
   setInitialized();
 }
@@ -226,6 +276,65 @@ inline void SignalMonitor::installSignalHandler()
   }
 }
 
+//----------------------------------------------------------------------
+inline void SignalMonitor::blockSignal()
+{
+  // The signal is no longer delivered to a signal handler,
+  // but is queued for reading from the signalfd
+
+  sigset_t signal_set{};
+  sigemptyset(&signal_set);
+  sigaddset(&signal_set, signal_number);
+  static const auto& fsystem = FSystem::getInstance();
+  const int error = fsystem->pthread_sigmask ( SIG_BLOCK, &signal_set
+                                             , getSigactionImpl()->getSigmask() );
+
+  if ( error != 0 )
+  {
+    std::error_code err_code{error, std::generic_category()};
+    std::system_error sys_err{err_code, strerror(error)};
+    throw sys_err;
+  }
+}
+
+//----------------------------------------------------------------------
+void SignalMonitor::unblockSignal() const
+{
+  // Unblock the signal if it was not blocked before
+
+  if ( sigismember(getSigactionImpl()->getSigmask(), signal_number) == 1 )
+    return;
+
+  sigset_t signal_set{};
+  sigemptyset(&signal_set);
+  sigaddset(&signal_set, signal_number);
+  static const auto& fsystem = FSystem::getInstance();
+  fsystem->pthread_sigmask (SIG_UNBLOCK, &signal_set, nullptr);
+}
+
+//----------------------------------------------------------------------
+inline void SignalMonitor::createSignalFd()
+{
+  // Set up a signalfd for notification
+
+#if defined(USE_SIGNALFD)
+  sigset_t signal_set{};
+  sigemptyset(&signal_set);
+  sigaddset(&signal_set, signal_number);
+  static const auto& fsystem = FSystem::getInstance();
+  const int signal_fd = fsystem->signalfd ( -1, &signal_set
+                                          , SFD_NONBLOCK | SFD_CLOEXEC );
+
+  if ( signal_fd < 0 )
+  {
+    unblockSignal();
+    throw monitor_error{"No signalfd could be set up for the signal monitor."};
+  }
+
+  setFileDescriptor(signal_fd);
+#endif  // defined(USE_SIGNALFD)
+}
+
 //----------------------------------------------------------------------
 inline void SignalMonitor::enterMonitorInstanceInTable()
 {
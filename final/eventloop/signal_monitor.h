@@ -92,6 +92,9 @@ class SignalMonitor final : public Monitor
     void ensureSignalIsUnmonitored() const;
     void createPipe();
     void installSignalHandler();
+    void blockSignal();
+    void unblockSignal() const;
+    void createSignalFd();
     void enterMonitorInstanceInTable();
     auto getSigactionImpl() const -> const SigactionImpl*;
     auto getSigactionImpl() -> SigactionImpl*;
@@ -23,24 +23,24 @@
 /*  Inheritance diagram
  *  ═══════════════════
  *
- *                          ▕▔▔▔▔▔▔▔▔▔▏
- *                          ▕ Monitor ▏
- *                          ▕▁▁▁▁▁▁▁▁▁▏
- *                               ▲
- *                               │
- *                      ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- *                      ▕ TimerMonitorImpl ▏
- *                      ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
- *                        ▲              ▲
- *                        │              │
- * ▕▔▔▔▔▔▔▔▔▔▔▏1   1▕▔▔▔▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- * ▕ PipeData ▏- - -▕ PosixTimer ▏ ▕ KqueueTimer ▏ (platform-specific)
- * ▕▁▁▁▁▁▁▁▁▁▁▏     ▕▁▁▁▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
- *                           ▲         ▲
- *                           │         │
- *                         ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- *                         ▕ TimerMonitor ▏
- *                         ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                                    ▕▔▔▔▔▔▔▔▔▔▏
+ *                                    ▕ Monitor ▏
+ *                                    ▕▁▁▁▁▁▁▁▁▁▏
+ *                                         ▲
+ *                                         │
+ *                               ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *                               ▕ TimerMonitorImpl ▏
+ *                               ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                         ▲               ▲               ▲
+ *                         │               │               │
+ * ▕▔▔▔▔▔▔▔▔▔▔▏1   1▕▔▔▔▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ PipeData ▏- - -▕ PosixTimer ▏ ▕ TimerfdTimer ▏ ▕ KqueueTimer ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▏     ▕▁▁▁▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                         ▲               ▲               ▲
+ *                         │               │               │
+ *                                 ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *                                 ▕ TimerMonitor ▏  (the base class is
+ *                                 ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏   platform-specific)
  */
 
 #ifndef TIMER_MONITOR_H
@@ -55,6 +55,10 @@
   #define USE_POSIX_TIMER
 #endif
 
+#if defined(__linux__)
+  #define USE_TIMERFD_TIMER
+#endif
+
 #include <ctime>
 
 #include <chrono>
@@ -151,6 +155,57 @@ inline void PosixTimer::init (handler_t hdl, T&& uc)
 #endif  // defined(USE_POSIX_TIMER)
 
 
+//----------------------------------------------------------------------
+// class TimerfdTimer
+//----------------------------------------------------------------------
+
+class TimerfdTimer : public TimerMonitorImpl
+{
+  public:
+    // Using-declaration
+    using TimerMonitorImpl::TimerMonitorImpl;
+
+    // Disable copy constructor
+    TimerfdTimer (const TimerfdTimer&) = delete;
+
+    // Disable move constructor
+    TimerfdTimer (TimerfdTimer&&) noexcept = delete;
+
+    // Destructor
+    ~TimerfdTimer() noexcept override;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const TimerfdTimer&) -> TimerfdTimer& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (TimerfdTimer&&) noexcept -> TimerfdTimer& = delete;
+
+    // Methods
+    template <typename T>
+    void init (handler_t, T&&);
+    void setInterval ( std::chrono::nanoseconds
+                     , std::chrono::nanoseconds ) override;
+    void trigger(short) override;
+
+  private:
+    void init();
+};
+
+#if defined(USE_TIMERFD_TIMER)
+//----------------------------------------------------------------------
+template <typename T>
+inline void TimerfdTimer::init (handler_t hdl, T&& uc)
+{
+  if ( isInitialized() )
+    throw monitor_error{"This instance has already been initialised."};
+
+  setHandler (std::move(hdl));
+  setUserContext (std::forward<T>(uc));
+  init();
+}
+#endif  // defined(USE_TIMERFD_TIMER)
+
+
 //----------------------------------------------------------------------
 // class KqueueTimer
 //----------------------------------------------------------------------
@@ -236,6 +291,8 @@ struct TimerClass
     using type = KqueueTimer;
   #elif defined(__OpenBSD__)
     using type = KqueueTimer;
+  #elif defined(__linux__)
+    using type = TimerfdTimer;
   #else
     using type = PosixTimer;
   #endif
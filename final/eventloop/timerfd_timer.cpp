@@ -0,0 +1,123 @@
+/***********************************************************************
+* timerfd_timer.cpp - Timer monitoring object with a Linux timerfd     *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2024 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#if defined(__linux__)
+  #define USE_TIMERFD_TIMER
+#endif
+
+#if defined(USE_TIMERFD_TIMER)
+
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <system_error>
+
+#include "final/eventloop/eventloop.h"
+#include "final/eventloop/timer_monitor.h"
+#include "final/util/fsystem.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+static auto nanosecondsToTimespec (std::chrono::nanoseconds duration) -> timespec
+{
+  const auto seconds{std::chrono::duration_cast<std::chrono::seconds>(duration)};
+  duration -= seconds;
+
+  return timespec{ static_cast<time_t>(seconds.count())
+                 , static_cast<long>(duration.count()) };
+}
+
+
+//----------------------------------------------------------------------
+// class TimerfdTimer
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+TimerfdTimer::~TimerfdTimer() noexcept  // destructor
+{
+  if ( getFileDescriptor() == NO_FILE_DESCRIPTOR )
+    return;
+
+  static const auto& fsystem = FSystem::getInstance();
+  fsystem->close (getFileDescriptor());
+}
+
+
+// public methods of TimerfdTimer
+//----------------------------------------------------------------------
+void TimerfdTimer::setInterval ( std::chrono::nanoseconds first,
+                                 std::chrono::nanoseconds periodic )
+{
+  static const auto& fsystem = FSystem::getInstance();
+  struct itimerspec timer_spec { nanosecondsToTimespec(periodic)
+                               , nanosecondsToTimespec(first) };
+
+  if ( fsystem->timerfd_settime(getFileDescriptor(), 0, &timer_spec, nullptr) != -1 )
+    return;
+
+  const int error = errno;
+  std::error_code err_code{error, std::generic_category()};
+  std::system_error sys_err{err_code, strerror(error)};
+  throw sys_err;
+}
+
+//----------------------------------------------------------------------
+void TimerfdTimer::trigger (short return_events)
+{
+  // Reading the expiration counter resets the readiness of the timerfd.
+  // Several expirations since the last read are reported only once.
+
+  uint64_t expirations{0};
+
+  if ( ::read(getFileDescriptor(), &expirations, sizeof(expirations)) <= 0 )
+    return;  // Spurious wakeup (EAGAIN)
+
+  Monitor::trigger(return_events);
+}
+
+
+// private methods of TimerfdTimer
+//----------------------------------------------------------------------
+void TimerfdTimer::init()
+{
+  static const auto& fsystem = FSystem::getInstance();
+  const int timer_fd = fsystem->timerfd_create ( CLOCK_MONOTONIC
+                                               , TFD_NONBLOCK | TFD_CLOEXEC );
+
+  if ( timer_fd < 0 )
+    throw monitor_error{"No timerfd timer could be reserved."};
+
+  setEvents (POLLIN);
+  setFileDescriptor (timer_fd);
+  setInitialized();
+}
+
+}  // namespace finalcut
+
+#endif  // defined(USE_TIMERFD_TIMER)
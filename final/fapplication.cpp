@@ -20,15 +20,22 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <csignal>
+#include <cstdlib>
+
 #include <chrono>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <thread>
 
 #include "final/dialog/fmessagebox.h"
+#include "final/eventloop/eventloop.h"
+#include "final/eventloop/io_monitor.h"
+#include "final/eventloop/signal_monitor.h"
 #include "final/fapplication.h"
 #include "final/fevent.h"
 #include "final/fstartoptions.h"
@@ -199,9 +206,15 @@ auto FApplication::enterLoop() -> int  // event loop
   const bool old_app_exit_loop = internal::var::exit_loop;
   internal::var::exit_loop = false;
 
+  if ( loop_level == 1 && getStartOptions().event_loop )
+    initEventLoop();
+
   while ( ! (quit_now || internal::var::exit_loop) )
     processNextEvent();
 
+  if ( loop_level == 1 )
+    finishEventLoop();
+
   internal::var::exit_loop = old_app_exit_loop;
   loop_level--;
   return 0;
@@ -497,6 +510,10 @@ inline auto FApplication::getLongOptions() -> const std::vector<CmdOption>&
     {"no-terminal-focus-events", no_argument,       nullptr,  'f' },
     {"no-color-change",          no_argument,       nullptr,  'c' },
     {"no-sgr-optimizer",         no_argument,       nullptr,  's' },
+    {"no-sync-output",           no_argument,       nullptr,  'u' },
+    {"event-loop",               no_argument,       nullptr,  'p' },
+    {"compositing-threads",      required_argument, nullptr,  'j' },
+    {"frame-rate",               required_argument, nullptr,  'x' },
     {"vgafont",                  no_argument,       nullptr,  'v' },
     {"newfont",                  no_argument,       nullptr,  'n' },
     {"dark-theme",               no_argument,       nullptr,  't' },
@@ -518,6 +535,7 @@ inline void FApplication::setCmdOptionsMap (CmdMap& cmd_map)
 {
   auto enc = [] (const auto& s) { FApplication::setTerminalEncoding(s); };
   auto log = [] (const auto& s) { FApplication::setLogFile(s); };
+  auto thr = [] (const auto& s) { FVTerm::setCompositingThreads(std::strtoul(s, nullptr, 10)); };
   auto opt = &FApplication::getStartOptions;
 
   // --encoding
@@ -538,6 +556,14 @@ inline void FApplication::setCmdOptionsMap (CmdMap& cmd_map)
   cmd_map['c'] = [opt] (const auto&) { opt().color_change = false; };
   // --no-sgr-optimizer
   cmd_map['s'] = [opt] (const auto&) { opt().sgr_optimizer = false; };
+  // --no-sync-output
+  cmd_map['u'] = [opt] (const auto&) { opt().synchronized_update = false; };
+  // --event-loop
+  cmd_map['p'] = [opt] (const auto&) { opt().event_loop = true; };
+  // --compositing-threads
+  cmd_map['j'] = [thr] (const auto& arg) { thr(arg); };
+  // --frame-rate
+  cmd_map['x'] = [opt] (const auto& arg) { opt().frame_rate = uInt(std::strtoul(arg, nullptr, 10)); };
   // --vgafont
   cmd_map['v'] = [opt] (const auto&) { opt().vgafont = true; };
   // --newfont
@@ -630,6 +656,14 @@ void FApplication::showParameterUsage()
     << "    Do not redefine the color palette\n"
     << "  --no-sgr-optimizer        "
     << "    Do not optimize SGR sequences\n"
+    << "  --no-sync-output          "
+    << "    Do not use synchronized terminal output\n"
+    << "  --event-loop              "
+    << "    Sleep until input, signals or timers arrive\n"
+    << "  --compositing-threads=<N> "
+    << "    Composite large windows with N threads\n"
+    << "  --frame-rate=<FPS>        "
+    << "    Limit the terminal updates per second\n"
     << "  --vgafont                 "
     << "    Set the standard vga 8x16 font\n"
     << "  --newfont                 "
@@ -696,6 +730,9 @@ inline auto FApplication::isKeyPressed (uInt64 ms) const -> bool
   if ( mouse.isGpmMouseEnabled() )
     return mouse.getGpmKeyPressed(keyboard.hasUnprocessedInput());
 
+  if ( event_loop )  // The stdin monitor has already polled the input
+    return has_stdin_input || keyboard.hasUnprocessedInput();
+
   return (keyboard.isKeyPressed(blocking_time) || keyboard.hasPendingInput());
 }
 
@@ -1373,20 +1410,15 @@ void FApplication::processLogger() const
 //----------------------------------------------------------------------
 auto FApplication::processNextEvent() -> bool
 {
+  if ( event_loop )
+    return processEventLoop();
+
   uInt num_events{0};
 
   if ( hasDataInQueue() || hasTerminalResized() || isNextEventTimeout() )
   {
     time_last_event = FObjectTimer::getCurrentTime();
-    num_events += processTimerEvent();
-    processInput();
-    processResizeEvent();  // when the terminal size has changed
-    processCloseWidget();
-    sendQueuedEvents();
-    processDialogResizeMove();
-    processTerminalUpdate();  // for changed areas on the terminal
-    flush();  // Flush output buffer (via an instance of FOutput)
-    processLogger();
+    num_events += processPendingEvents();
   }
   else if ( isKeyPressed(next_event_wait) )
   {
@@ -1397,6 +1429,117 @@ auto FApplication::processNextEvent() -> bool
   return ( num_events > 0 );
 }
 
+//----------------------------------------------------------------------
+auto FApplication::processPendingEvents() -> uInt
+{
+  const uInt num_events = processTimerEvent();
+  processInput();
+  processResizeEvent();  // when the terminal size has changed
+  processCloseWidget();
+  sendQueuedEvents();
+  processDialogResizeMove();
+  processTerminalUpdate();  // for changed areas on the terminal
+  flush();  // Flush output buffer (via an instance of FOutput)
+  processLogger();
+  return num_events;
+}
+
+//----------------------------------------------------------------------
+void FApplication::initEventLoop()
+{
+  // Instead of polling every 5 ms, the application sleeps in an
+  // EventLoop until keyboard input, a resize signal or a timer
+  // event arrives
+
+  static auto& mouse = FMouseControl::getInstance();
+
+  if ( mouse.isGpmMouseEnabled() )  // gpm input requires polling
+    return;
+
+  try
+  {
+    event_loop = std::make_unique<EventLoop>();
+
+    // Keyboard and mouse input on stdin
+    stdin_monitor = std::make_unique<IoMonitor>(event_loop.get());
+    stdin_monitor->init ( FTermios::getStdIn(), POLLIN
+                        , [this] (const Monitor*, short)
+                          {
+                            has_stdin_input = true;
+                          }
+                        , nullptr );
+    stdin_monitor->resume();
+
+    // Terminal size changes
+    resize_monitor = std::make_unique<SignalMonitor>(event_loop.get());
+    resize_monitor->init ( SIGWINCH
+                         , [] (const Monitor*, short)
+                           {
+                             FTermData::getInstance().setTermResized(true);
+                           }
+                         , nullptr );
+    resize_monitor->resume();
+  }
+  catch (const std::exception& ex)
+  {
+    getLog()->warn(std::string("Event loop not available: ") + ex.what());
+    finishEventLoop();  // Fall back to polling
+  }
+}
+
+//----------------------------------------------------------------------
+void FApplication::finishEventLoop()
+{
+  // The monitors have to unregister before the event loop is deleted
+  resize_monitor.reset();  // Restores the previous SIGWINCH handling
+  stdin_monitor.reset();
+  event_loop.reset();
+  has_stdin_input = false;
+}
+
+//----------------------------------------------------------------------
+auto FApplication::getEventLoopTimeout() const -> int
+{
+  // Returns the maximum waiting time for the next event in ms
+
+  static const auto& keyboard = FKeyboard::getInstance();
+  const auto& close_list = getWidgetCloseList();
+
+  if ( eventInQueue() || hasDataInQueue()
+    || (close_list && ! close_list->empty()) )
+    return 0;  // There is still work to do
+
+  // Incomplete key sequences and delayed terminal
+  // updates are checked at the normal polling rate
+  if ( keyboard.hasUnprocessedInput() || hasPendingTerminalUpdates() )
+    return int(next_event_wait / 1000);
+
+  const auto time_left = FObjectTimer::getTimeUntilNextTimeout();
+
+  if ( time_left == steady_clock::duration::max() )
+    return EventLoop::WAIT_INDEFINITELY;
+
+  if ( time_left <= steady_clock::duration::zero() )
+    return 0;
+
+  // Round up, so as not to wake up shortly before the timer expires
+  const auto wait = duration_cast<milliseconds>(time_left).count() + 1;
+  return int(std::min<decltype(wait)>(wait, std::numeric_limits<int>::max()));
+}
+
+//----------------------------------------------------------------------
+inline auto FApplication::processEventLoop() -> bool
+{
+  // Waits until a monitor reports an event or the next timer expires
+  event_loop->runOnce (getEventLoopTimeout());
+  time_last_event = FObjectTimer::getCurrentTime();
+  hasTerminalResized();  // Updates has_terminal_resized
+  const uInt num_events = processPendingEvents();
+  has_stdin_input = false;
+  processExternalUserEvent();
+  return ( num_events > 0 );
+}
+
 //----------------------------------------------------------------------
 void FApplication::performTimerAction (FObject* receiver, FEvent* event)
 {
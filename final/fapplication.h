@@ -76,6 +76,7 @@ namespace finalcut
 // class forward declaration
 class FAccelEvent;
 class FCloseEvent;
+class EventLoop;
 class FEvent;
 class FFocusEvent;
 class FKeyEvent;
@@ -88,6 +89,8 @@ class FWheelEvent;
 class FMouseControl;
 class FPoint;
 class FObject;
+class IoMonitor;
+class SignalMonitor;
 
 //----------------------------------------------------------------------
 // class FApplication
@@ -166,6 +169,9 @@ class FApplication : public FWidget
     using EventPair = std::pair<FObject*, FEvent*>;
     using FEventQueue = std::deque<EventPair>;
     using FMouseHandlerList = std::vector<FMouseHandler>;
+    using EventLoopPtr = std::unique_ptr<EventLoop>;
+    using IoMonitorPtr = std::unique_ptr<IoMonitor>;
+    using SignalMonitorPtr = std::unique_ptr<SignalMonitor>;
     using CmdMap = std::unordered_map<int, std::function<void(char*)>>;
 
     // Methods
@@ -232,6 +238,11 @@ class FApplication : public FWidget
     void         processDialogResizeMove() const;
     void         processLogger() const;
     auto         processNextEvent() -> bool;
+    auto         processPendingEvents() -> uInt;
+    void         initEventLoop();
+    void         finishEventLoop();
+    auto         getEventLoopTimeout() const -> int;
+    auto         processEventLoop() -> bool;
     void         performTimerAction (FObject*, FEvent*) override;
     auto         hasTerminalResized() -> bool;
     static auto  isEventProcessable (FObject*, const FEvent*) -> bool;
@@ -245,6 +256,10 @@ class FApplication : public FWidget
     FEventQueue       event_queue{};
     FMouseHandlerList mouse_handler_list{};
     bool              has_terminal_resized{false};
+    bool              has_stdin_input{false};
+    EventLoopPtr      event_loop{};
+    IoMonitorPtr      stdin_monitor{};
+    SignalMonitorPtr  resize_monitor{};
     static uInt64     next_event_wait;
     static TimeValue  time_last_event;
     static int        loop_level;
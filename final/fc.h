@@ -880,7 +880,7 @@ constexpr auto operator -= (FKey& k1, uInt32 k2) noexcept -> FKey&
 
 
 // Terminal color names
-enum class FColor : uInt16
+enum class FColor : uInt32
 {
   Black             = 0,
   Blue              = 1,
@@ -1139,69 +1139,69 @@ enum class FColor : uInt16
   Grey85            = 253,  // #dadada
   Grey89            = 254,  // #e4e4e4
   Grey93            = 255,  // #eeeeee
-  Default           = static_cast<uInt16>(-1),
-  Undefined         = static_cast<uInt16>(-2)
+  Default           = static_cast<uInt32>(-1),
+  Undefined         = static_cast<uInt32>(-2)
 };
 
 constexpr auto operator >> (const FColor& c, const uInt16 n) noexcept -> FColor
 {
-  return FColor(uInt16(c) >> n);
+  return FColor(uInt32(c) >> n);
 }
 
 constexpr auto operator << (const FColor& c, const uInt16 n) noexcept -> FColor
 {
-  return FColor(uInt16(c) << n);
+  return FColor(uInt32(c) << n);
 }
 
 constexpr auto operator < (const FColor& c, const uInt16 n) noexcept -> bool
 {
-  return uInt16(c) < n;
+  return uInt32(c) < n;
 }
 
 constexpr auto operator > (const FColor& c, const uInt16 n) noexcept -> bool
 {
-  return uInt16(c) > n;
+  return uInt32(c) > n;
 }
 
 constexpr auto operator == (const FColor& c, const uInt16 n) noexcept -> bool
 {
-  return uInt16(c) == n;
+  return uInt32(c) == n;
 }
 
 constexpr auto operator <= (const FColor& c, const uInt16 n) noexcept -> bool
 {
-  return uInt16(c) <= n;
+  return uInt32(c) <= n;
 }
 
 constexpr auto operator >= (const FColor& c, const uInt16 n) noexcept -> bool
 {
-  return uInt16(c) >= n;
+  return uInt32(c) >= n;
 }
 
 constexpr auto operator + (const FColor& c, const uInt16 n) noexcept -> FColor
 {
-  return FColor(uInt16(c) + n);
+  return FColor(uInt32(c) + n);
 }
 
 constexpr auto operator - (const FColor& c, const uInt16 n) noexcept -> FColor
 {
-  return FColor(uInt16(c) - n);
+  return FColor(uInt32(c) - n);
 }
 
 constexpr auto operator % (const FColor& c, const uInt16 n) noexcept -> FColor
 {
-  return FColor(uInt16(c) % n);
+  return FColor(uInt32(c) % n);
 }
 
 constexpr auto operator %= (FColor& c, uInt16 n) noexcept -> FColor&
 {
-  c = FColor(uInt16(c) % n);
+  c = FColor(uInt32(c) % n);
   return c;
 }
 
 constexpr auto operator ++ (FColor& c) noexcept -> FColor&  // prefix
 {
-  c = ( uInt16(c) < 255 ) ? FColor(uInt16(c) + 1) : FColor::Default;
+  c = ( uInt32(c) < 255 ) ? FColor(uInt32(c) + 1) : FColor::Default;
   return c;
 }
 
@@ -1214,11 +1214,11 @@ constexpr auto operator ++ (FColor& c, int) noexcept -> FColor  // postfix
 
 constexpr auto operator -- (FColor& c) noexcept -> FColor&  // prefix
 {
-  if ( uInt16(c) > 0 )
-    return (c = FColor(uInt16(c) - 1));
+  if ( uInt32(c) > 0 )
+    return (c = FColor(uInt32(c) - 1));
 
   if ( c == FColor::Black )        // value 0
-    return (c = FColor::Default);  // value uInt16(-1)
+    return (c = FColor::Default);  // value uInt32(-1)
 
   return (c = FColor(255));        // --(-1) = 255
 }
@@ -1231,6 +1231,35 @@ constexpr auto operator -- (FColor& c, int) noexcept -> FColor  // postfix
 }
 
 
+// Direct 24-bit RGB colors
+constexpr uInt32 rgb_color_flag = 0x01000000;  // Not a palette index
+
+constexpr auto rgb2Color (uInt8 r, uInt8 g, uInt8 b) noexcept -> FColor
+{
+  return FColor(rgb_color_flag | uInt32(r) << 16 | uInt32(g) << 8 | uInt32(b));
+}
+
+constexpr auto isRGBColor (const FColor& c) noexcept -> bool
+{
+  return (uInt32(c) & 0xff000000) == rgb_color_flag;
+}
+
+constexpr auto getRedValue (const FColor& c) noexcept -> uInt8
+{
+  return uInt8(uInt32(c) >> 16);
+}
+
+constexpr auto getGreenValue (const FColor& c) noexcept -> uInt8
+{
+  return uInt8(uInt32(c) >> 8);
+}
+
+constexpr auto getBlueValue (const FColor& c) noexcept -> uInt8
+{
+  return uInt8(uInt32(c));
+}
+
+
 // Terminal attribute style names
 enum class Style : uInt16
 {
@@ -1544,6 +1573,10 @@ enum class Termcap
   t_cursor_style,
   t_scroll_forward,
   t_scroll_reverse,
+  t_change_scroll_region,
+  t_enter_lr_margin_mode,
+  t_set_lr_margins,
+  t_exit_lr_margin_mode,
   t_enter_ca_mode,
   t_exit_ca_mode,
   t_enable_acs,
@@ -52,6 +52,8 @@ FStartOptions::FStartOptions()
 #endif
   , dark_theme{false}
   , color_change{true}
+  , synchronized_update{true}
+  , event_loop{false}
 { }
 
 
@@ -70,6 +72,9 @@ void FStartOptions::setDefault()
   mouse_support = true;
   terminal_detection = true;
   color_change = true;
+  synchronized_update = true;
+  event_loop = false;
+  frame_rate = 0;
   vgafont = false;
   newfont = false;
   encoding = Encoding::Unknown;
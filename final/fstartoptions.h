@@ -83,8 +83,11 @@ class FStartOptions final
 
     uInt16 dark_theme           : 1;
     uInt16 color_change         : 1;
-    uInt16                      : 14;  // padding bits
+    uInt16 synchronized_update  : 1;
+    uInt16 event_loop           : 1;
+    uInt16                      : 12;  // padding bits
 
+    uInt          frame_rate{0};  // Frames per second (0 = default)
     Encoding      encoding{Encoding::Unknown};
     std::ofstream logfile_stream{};
 };
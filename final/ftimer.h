@@ -39,7 +39,10 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "final/fevent.h"
@@ -62,12 +65,217 @@ using std::chrono::duration_cast;
 using std::chrono::seconds;
 using std::chrono::milliseconds;
 using std::chrono::microseconds;
+using std::chrono::steady_clock;
 using std::chrono::system_clock;
 using std::chrono::time_point;
 
 // class forward declaration
 class FEvent;
 
+//----------------------------------------------------------------------
+// class FTimerQueue
+//----------------------------------------------------------------------
+
+template <typename TimerDataT>
+class FTimerQueue
+{
+  public:
+    // Using-declaration
+    using size_type = std::size_t;
+    using TimePoint = decltype(TimerDataT::timeout);
+
+    // Accessors
+    auto top() const -> const TimerDataT&;
+    auto size() const noexcept -> size_type;
+
+    // Inquiry
+    auto empty() const noexcept -> bool;
+
+    // Methods
+    void push (const TimerDataT&);
+    auto erase (int) -> bool;
+    template <typename PredicateT>
+    auto eraseIf (PredicateT) -> bool;
+    void rescheduleTop (const TimePoint&);
+    void clear();
+    void shrink_to_fit();
+
+  private:
+    // Methods
+    void siftUp (size_type);
+    void siftDown (size_type);
+    void swapNodes (size_type, size_type);
+    void rebuild();
+
+    // Data members
+    std::vector<TimerDataT>            heap{};
+    std::unordered_map<int, size_type> position{};
+};
+
+// FTimerQueue inline functions
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+inline auto FTimerQueue<TimerDataT>::top() const -> const TimerDataT&
+{ return heap.front(); }
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+inline auto FTimerQueue<TimerDataT>::size() const noexcept -> size_type
+{ return heap.size(); }
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+inline auto FTimerQueue<TimerDataT>::empty() const noexcept -> bool
+{ return heap.empty(); }
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+inline void FTimerQueue<TimerDataT>::clear()
+{
+  heap.clear();
+  position.clear();
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+inline void FTimerQueue<TimerDataT>::shrink_to_fit()
+{ heap.shrink_to_fit(); }
+
+// public methods of FTimerQueue
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+void FTimerQueue<TimerDataT>::push (const TimerDataT& data)
+{
+  // Inserts a timer in O(log n)
+
+  heap.push_back(data);
+  position[data.id] = heap.size() - 1;
+  siftUp (heap.size() - 1);
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+auto FTimerQueue<TimerDataT>::erase (int id) -> bool
+{
+  // Removes the timer with the given identifier in O(log n)
+
+  const auto iter = position.find(id);
+
+  if ( iter == position.end() )
+    return false;
+
+  const auto index = iter->second;
+  const auto last = heap.size() - 1;
+
+  if ( index != last )
+    swapNodes (index, last);
+
+  heap.pop_back();
+  position.erase(id);
+
+  if ( index < heap.size() )
+  {
+    siftUp (index);
+    siftDown (index);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+template <typename PredicateT>
+auto FTimerQueue<TimerDataT>::eraseIf (PredicateT predicate) -> bool
+{
+  // Removes all matching timers and restores the heap in O(n)
+
+  const auto old_size = heap.size();
+  heap.erase ( std::remove_if(heap.begin(), heap.end(), predicate)
+             , heap.end() );
+
+  if ( heap.size() == old_size )
+    return false;
+
+  rebuild();
+  return true;
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+void FTimerQueue<TimerDataT>::rescheduleTop (const TimePoint& timeout)
+{
+  // Moves the earliest timer to its new expiration time in O(log n)
+
+  heap.front().timeout = timeout;
+  siftDown (0);
+}
+
+// private methods of FTimerQueue
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+void FTimerQueue<TimerDataT>::siftUp (size_type index)
+{
+  while ( index > 0 )
+  {
+    const auto parent = (index - 1) / 2;
+
+    if ( ! (heap[index].timeout < heap[parent].timeout) )
+      break;
+
+    swapNodes (index, parent);
+    index = parent;
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+void FTimerQueue<TimerDataT>::siftDown (size_type index)
+{
+  const auto count = heap.size();
+
+  while ( true )
+  {
+    const auto left = 2 * index + 1;
+    const auto right = left + 1;
+    auto smallest = index;
+
+    if ( left < count && heap[left].timeout < heap[smallest].timeout )
+      smallest = left;
+
+    if ( right < count && heap[right].timeout < heap[smallest].timeout )
+      smallest = right;
+
+    if ( smallest == index )
+      break;
+
+    swapNodes (index, smallest);
+    index = smallest;
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+inline void FTimerQueue<TimerDataT>::swapNodes (size_type a, size_type b)
+{
+  std::swap (heap[a], heap[b]);
+  position[heap[a].id] = a;
+  position[heap[b].id] = b;
+}
+
+//----------------------------------------------------------------------
+template <typename TimerDataT>
+void FTimerQueue<TimerDataT>::rebuild()
+{
+  position.clear();
+
+  for (size_type i{0}; i < heap.size(); i++)
+    position[heap[i].id] = i;
+
+  for (auto i = heap.size() / 2; i > 0; i--)
+    siftDown (i - 1);
+}
+
+
 //----------------------------------------------------------------------
 // class FTimer
 //----------------------------------------------------------------------
@@ -90,6 +298,8 @@ class FTimer
       return system_clock::now();  // Get the current time
     }
 
+    auto  getTimeUntilNextTimeout() const -> steady_clock::duration;
+
     // Inquiries
     auto  isTimeout (const TimeValue&, uInt64) -> bool;
 
@@ -102,14 +312,14 @@ class FTimer
   protected:
     struct FTimerData
     {
-      int          id;
-      milliseconds interval;
-      TimeValue    timeout;
-      ObjectT*     object;
+      int                      id;
+      milliseconds             interval;
+      steady_clock::time_point timeout;
+      ObjectT*                 object;
     };
 
     // Using-declaration
-    using FTimerList = std::vector<FTimerData>;
+    using FTimerList = FTimerQueue<FTimerData>;
     using FTimerListUniquePtr = std::unique_ptr<FTimerList>;
 
     // Accessor
@@ -135,6 +345,22 @@ class FTimer
 auto getNextId() -> int;
 
 // public methods of FTimer
+//----------------------------------------------------------------------
+template <typename ObjectT>
+auto FTimer<ObjectT>::getTimeUntilNextTimeout() const -> steady_clock::duration
+{
+  // Returns the time until the earliest timer expires (negative if
+  // it is overdue) or steady_clock::duration::max() without timers
+
+  std::shared_lock<std::shared_timed_mutex> lock(internal::timer_var::mutex);
+  const auto& timer_list = globalTimerList();
+
+  if ( ! timer_list || timer_list->empty() )
+    return steady_clock::duration::max();
+
+  return timer_list->top().timeout - steady_clock::now();
+}
+
 //----------------------------------------------------------------------
 template <typename ObjectT>
 inline auto FTimer<ObjectT>::isTimeout (const TimeValue& time, uInt64 timeout) -> bool
@@ -162,19 +388,8 @@ auto FTimer<ObjectT>::addTimer (ObjectT* object, int interval) & -> int
   auto& timer_list = globalTimerList();
   int id = getNextId();
   const auto time_interval = milliseconds(interval);
-  const auto timeout = getCurrentTime() + time_interval;
-  FTimerData timedata{ id, time_interval, timeout, object };
-
-  // Insert in list sorted by timeout
-  timer_list->insert( std::lower_bound( timer_list->cbegin()
-                                      , timer_list->cend()
-                                      , timedata
-                                      , [] (const auto& a, const auto& b)
-                                        {
-                                          return a.timeout < b.timeout;
-                                        }
-                                      )
-                    , timedata);
+  const auto timeout = steady_clock::now() + time_interval;
+  timer_list->push({ id, time_interval, timeout, object });
   return id;
 }
 
@@ -193,19 +408,7 @@ auto FTimer<ObjectT>::delTimer (int id) const & -> bool
   if ( ! timer_list || timer_list->empty() )
     return false;
 
-  auto iter = std::find_if ( timer_list->cbegin()
-                           , timer_list->cend()
-                           , [id] (const auto& timer)
-                             {
-                               return timer.id == id;
-                             }
-                           );
-
-  if ( iter == timer_list->cend() )
-    return false;
-
-  timer_list->erase(iter);
-  return true;
+  return timer_list->erase(id);
 }
 
 //----------------------------------------------------------------------
@@ -220,14 +423,10 @@ auto FTimer<ObjectT>::delOwnTimers(const ObjectT* object) const & -> bool
   if ( ! timer_list || timer_list->empty() )
     return false;
 
-  timer_list->erase ( std::remove_if( timer_list->begin()
-                                    , timer_list->end()
-                                    , [&object] (const auto& timer)
-                                      {
-                                        return timer.object == object;
-                                      }
-                                    )
-                    , timer_list->end() );
+  timer_list->eraseIf ( [&object] (const auto& timer)
+                        {
+                          return timer.object == object;
+                        } );
   return true;
 }
 
@@ -255,7 +454,7 @@ template <typename CallbackT>
 auto FTimer<ObjectT>::processTimerEvent (CallbackT callback) -> uInt
 {
   uInt activated{0};
-  std::shared_lock<std::shared_timed_mutex> lock ( internal::timer_var::mutex
+  std::unique_lock<std::shared_timed_mutex> lock ( internal::timer_var::mutex
                                                  , std::defer_lock );
 
   if ( ! lock.try_lock() )
@@ -266,19 +465,26 @@ auto FTimer<ObjectT>::processTimerEvent (CallbackT callback) -> uInt
   if ( ! timer_list || timer_list->empty() )
     return 0;
 
-  const auto& currentTime = getCurrentTime();
+  const auto current_time = steady_clock::now();
 
-  for (auto&& timer : *timer_list)
+  // The timers are taken from the top of the heap in the order of
+  // their expiration. Each expired timer is re-armed before its
+  // callback runs, so that it fires at most once per call.
+  while ( ! timer_list->empty()
+       && timer_list->top().timeout <= current_time )
   {
-    if ( ! timer.id
-      || ! timer.object
-      || currentTime < timer.timeout )  // Timer not expired
-      continue;
+    const auto timer = timer_list->top();
+    auto timeout = timer.timeout + timer.interval;
 
-    timer.timeout += timer.interval;
+    if ( timeout <= current_time )
+      timeout = current_time
+              + std::max ( steady_clock::duration(timer.interval)
+                         , steady_clock::duration(1) );
 
-    if ( timer.timeout < currentTime )
-      timer.timeout = currentTime + timer.interval;
+    timer_list->rescheduleTop(timeout);
+
+    if ( ! timer.object )
+      continue;
 
     if ( timer.interval > microseconds(0) )
       ++activated;
@@ -331,6 +537,11 @@ class FObjectTimer
       return timer->getCurrentTime();
     }
 
+    static inline auto getTimeUntilNextTimeout() -> steady_clock::duration
+    {
+      return timer->getTimeUntilNextTimeout();
+    }
+
     // Inquiries
     static auto isTimeout (const TimeValue& time, uInt64 timeout) -> bool
     {
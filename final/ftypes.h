@@ -378,7 +378,7 @@ static constexpr std::size_t UNICODE_MAX = 5;
 
 using FUnicode = std::array<wchar_t, UNICODE_MAX>;
 
-enum class FColor : uInt16;   // forward declaration
+enum class FColor : uInt32;   // forward declaration
 
 
 // FChar operator functions
@@ -423,7 +423,6 @@ inline auto getCompareBitMask() noexcept -> uInt32
 struct FChar
 {
   FUnicode   ch{};            // Character code
-  FUnicode   encoded_char{};  // Encoded output character
   FColor     fg_color{};      // Foreground color
   FColor     bg_color{};      // Background color
   FAttribute attr{};          // Attributes
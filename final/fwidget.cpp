@@ -109,6 +109,13 @@ FWidget::FWidget (FWidget* parent)
 //----------------------------------------------------------------------
 FWidget::~FWidget()  // destructor
 {
+  // Release the print area of an unfinished update batch
+  if ( update_depth > 0 )
+  {
+    update_depth = 0;
+    FVTerm::endUpdate();
+  }
+
   processDestroy();
   delCallback();
   removeQueuedEvent();
@@ -686,6 +693,24 @@ void FWidget::setDoubleFlatLine (Side side, int pos, bool bit)
     side_line[index] = bit;
 }
 
+//----------------------------------------------------------------------
+auto FWidget::isUpdating() const -> bool
+{
+  // Is an update batch open for this widget or one of its parents?
+
+  const auto* widget = this;
+
+  while ( widget )
+  {
+    if ( widget->update_depth > 0 )
+      return true;
+
+    widget = widget->getParentWidget();
+  }
+
+  return false;
+}
+
 //----------------------------------------------------------------------
 auto FWidget::childWidgetAt (const FPoint& pos) & -> FWidget*
 {
@@ -807,11 +832,65 @@ void FWidget::flushChanges()
   // to handle pending changes
 }
 
+//----------------------------------------------------------------------
+void FWidget::beginUpdate()
+{
+  // Starts an update batch for this widget and its children.
+  // Redraws and pending changes are collected until the
+  // matching endUpdate() call. The batch holds back the entire
+  // print area (usually the window of the widget), so changes of
+  // other widgets in this window also wait for endUpdate().
+
+  if ( update_depth == 0 )
+    FVTerm::beginUpdate();
+
+  update_depth++;
+}
+
+//----------------------------------------------------------------------
+void FWidget::endUpdate()
+{
+  // Closes an update batch and applies the collected changes once
+
+  if ( update_depth == 0 )
+    return;
+
+  update_depth--;
+
+  if ( update_depth > 0 )
+    return;
+
+  FVTerm::endUpdate();
+
+  if ( auto updating_widget = getUpdatingWidget() )
+  {
+    // Nested in the batch of a parent widget
+    updating_widget->redraw_pending |= redraw_pending;
+    redraw_pending = false;
+    return;
+  }
+
+  flushPendingChanges();
+
+  if ( ! redraw_pending )
+    return;
+
+  redraw_pending = false;
+  redraw();
+}
+
 //----------------------------------------------------------------------
 void FWidget::redraw()
 {
   // Redraw the widget immediately unless it is hidden.
 
+  if ( auto updating_widget = getUpdatingWidget() )
+  {
+    // Deferred until the update batch is closed
+    updating_widget->redraw_pending = true;
+    return;
+  }
+
   if ( ! redraw_root_widget )
     redraw_root_widget = this;
 
@@ -883,7 +962,12 @@ void FWidget::show()
   startShow();
   initWidgetLayout();    // Makes initial layout settings
   adjustSize();          // Alignment before drawing
-  draw();                // Draw the widget
+
+  if ( auto updating_widget = getUpdatingWidget() )
+    updating_widget->redraw_pending = true;  // Draw at the batch end
+  else
+    draw();              // Draw the widget
+
   flags.visibility.hidden = false;
   flags.visibility.shown = true;
   showChildWidgets();
@@ -2311,6 +2395,42 @@ void FWidget::setStatusbarText (bool enable) const
   getStatusBar()->drawMessage();
 }
 
+//----------------------------------------------------------------------
+auto FWidget::getUpdatingWidget() -> FWidget*
+{
+  // Returns the widget that opened the outermost update batch
+
+  FWidget* updating_widget{nullptr};
+  auto widget = this;
+
+  while ( widget )
+  {
+    if ( widget->update_depth > 0 )
+      updating_widget = widget;
+
+    widget = widget->getParentWidget();
+  }
+
+  return updating_widget;
+}
+
+//----------------------------------------------------------------------
+void FWidget::flushPendingChanges()
+{
+  // Applies the changes collected during an update batch
+
+  flushChanges();
+
+  if ( ! hasChildren() )
+    return;
+
+  for (auto* child : getChildren())
+  {
+    if ( child->isWidget() )
+      static_cast<FWidget*>(child)->flushPendingChanges();
+  }
+}
+
 
 // non-member functions
 //----------------------------------------------------------------------
@@ -270,6 +270,7 @@ class FWidget : public FVTerm
     auto  hasFocus() const -> bool;
     auto  acceptFocus() const -> bool;  // is focusable
     auto  isPaddingIgnored() const -> bool;
+    auto  isUpdating() const -> bool;
 
     // Methods
     auto  childWidgetAt (const FPoint&) & -> FWidget*;
@@ -280,12 +281,16 @@ class FWidget : public FVTerm
     void  addCallback (FString&&, Args&&...) & noexcept;
     template <typename... Args>
     void  delCallback (Args&&...) & noexcept;
+    void  emitCallback (FSignalId) const &;
+    void  emitCallback (const char*) const &;
     void  emitCallback (const FString&) const &;
     void  addAccelerator (FKey) &;
     virtual void addAccelerator (FKey, FWidget*) &;
     void  delAccelerator () &;
     virtual void delAccelerator (FWidget*) &;
     virtual void flushChanges();
+    void  beginUpdate() override;
+    void  endUpdate() override;
     virtual void redraw();
     virtual void resize();
     virtual void show();
@@ -474,6 +479,8 @@ class FWidget : public FVTerm
     static void  initColorTheme();
     void  removeQueuedEvent() const;
     void  setStatusbarText (bool = true) const;
+    auto  getUpdatingWidget() -> FWidget*;
+    void  flushPendingChanges();
 
     // Data members
     struct FWidgetFlags  flags{};
@@ -502,6 +509,8 @@ class FWidget : public FVTerm
     FAcceleratorList     accelerator_list{};
     EventMap             event_map{};
     FCallback            callback_impl{};
+    uInt                 update_depth{0};
+    bool                 redraw_pending{false};
 
     static FStatusBar*   statusbar;
     static FMenuBar*     menubar;
@@ -959,6 +968,18 @@ inline void FWidget::delCallback (Args&&... args) & noexcept
   callback_impl.delCallback(std::forward<Args>(args)...);
 }
 
+//----------------------------------------------------------------------
+inline void FWidget::emitCallback (FSignalId emit_signal) const &
+{
+  callback_impl.emitCallback(emit_signal);
+}
+
+//----------------------------------------------------------------------
+inline void FWidget::emitCallback (const char* emit_signal) const &
+{
+  callback_impl.emitCallback(emit_signal);
+}
+
 //----------------------------------------------------------------------
 inline void FWidget::emitCallback (const FString& emit_signal) const &
 {
@@ -1017,6 +1038,44 @@ inline void FWidget::processDestroy() const
 { emitCallback("destroy"); }
 
 
+//----------------------------------------------------------------------
+// class FUpdateGuard
+//----------------------------------------------------------------------
+
+class FUpdateGuard final
+{
+  public:
+    // Constructor
+    explicit FUpdateGuard (FWidget& w)
+      : widget{w}
+    {
+      widget.beginUpdate();
+    }
+
+    // Disable copy constructor
+    FUpdateGuard (const FUpdateGuard&) = delete;
+
+    // Disable move constructor
+    FUpdateGuard (FUpdateGuard&&) noexcept = delete;
+
+    // Destructor
+    ~FUpdateGuard()
+    {
+      widget.endUpdate();
+    }
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FUpdateGuard&) -> FUpdateGuard& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (FUpdateGuard&&) noexcept -> FUpdateGuard& = delete;
+
+  private:
+    // Data members
+    FWidget& widget;
+};
+
+
 // Non-member elements for NewFont
 //----------------------------------------------------------------------
 constexpr wchar_t NF_menu_button[]
@@ -404,13 +404,11 @@ void drawTransparentShadow (FWidget* w)
     uInt(area.shadow.height),
     {
       { { L'\0',  L'\0', L'\0', L'\0', L'\0' } },
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       FColor::Default,
       FColor::Default,
       { { 0x00, 0x20, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x32 = transparent)
     },
     {
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.fg,
       wc->shadow.bg,
@@ -433,15 +431,13 @@ inline void drawRightShadow (TransparentShadowData& d)
   if ( d.shadow_width > 0 )  // Draw right shadow
   {
     std::fill (d.area_pos, d.area_pos + d.shadow_width, d.transparent_char);
-    d.area.changes[0].xmin = std::min(d.area.changes[0].xmin, d.width);
-    d.area.changes[0].xmax = d.width + d.shadow_width - 1;
+    d.area.changes[0].mark (d.width, d.width + d.shadow_width - 1);
     d.area.changes[0].trans_count += d.shadow_width;
 
     for (std::size_t y{1}; y < d.height; y++)
     {
       d.area_pos += d.shadow_width + d.width;
-      d.area.changes[y].xmin = std::min(d.area.changes[y].xmin, d.width);
-      d.area.changes[y].xmax = d.width + d.shadow_width - 1;
+      d.area.changes[y].mark (d.width, d.width + d.shadow_width - 1);
       d.area.changes[y].trans_count += d.shadow_width;
       std::fill (d.area_pos, d.area_pos + d.shadow_width, d.color_overlay_char);
     }
@@ -455,8 +451,7 @@ inline void drawBottomShadow (TransparentShadowData& d)
 {
   for (std::size_t y{d.height}; y < d.height + d.shadow_height; y++)  // Draw bottom shadow
   {
-    d.area.changes[y].xmin = 0;
-    d.area.changes[y].xmax = d.width + d.shadow_width - 1;
+    d.area.changes[y].set (0, d.width + d.shadow_width - 1);
     d.area.changes[y].trans_count += d.width + d.shadow_width;
     std::fill (d.area_pos, d.area_pos + d.shadow_width, d.transparent_char);
     d.area_pos += d.shadow_width;
@@ -479,28 +474,24 @@ void drawBlockShadow (FWidget* w)
   {{
     {
       { { wchar_t(UniChar::LowerHalfBlock),  L'\0', L'\0', L'\0', L'\0' } },  // ▄
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.bg,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
     },
     {
       { { wchar_t(UniChar::FullBlock),  L'\0', L'\0', L'\0', L'\0' } },  // █
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.bg,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
     },
     {
       { { L' ',  L'\0', L'\0', L'\0', L'\0' } },  // ' '
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       FColor::Default,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
     },
     {
       { { wchar_t(UniChar::UpperHalfBlock),  L'\0', L'\0', L'\0', L'\0' } },  // ▄
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.bg,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
@@ -534,7 +525,6 @@ void clearBlockShadow (FWidget* w)
   FChar spacer_char
   {
     { { L' ',  L'\0', L'\0', L'\0', L'\0' } },  // ' '
-    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     FColor::Default,
     FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
@@ -578,16 +568,14 @@ void drawGenericBlockShadow ( FWidget* w
   auto& area_changes = area.changes;
   auto* area_pos = &area.getFChar(int(x_offset + width), int(y_offset));
   *area_pos = shadow_char[0];  // ▄
-  area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + width);
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
+  area_changes[y].mark (x_offset + width, x_offset + width);
   area_changes[y].trans_count++;
 
   for (y = y_offset + 1; y < y_offset + height; y++)
   {
     area_pos = &area.getFChar(int(x_offset + width), int(y));
     *area_pos = shadow_char[1];  // █
-    area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + width);
-    area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
+    area_changes[y].mark (x_offset + width, x_offset + width);
     area_changes[y].trans_count++;
   }
 
@@ -595,8 +583,7 @@ void drawGenericBlockShadow ( FWidget* w
   *area_pos = shadow_char[2];  // ' '
   ++area_pos;
   std::fill (area_pos, area_pos + width, shadow_char[3]);  // ▀
-  area_changes[y].xmin = std::min(area_changes[y].xmin, uInt(x_offset));
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
+  area_changes[y].mark (uInt(x_offset), x_offset + width);
   area_changes[y].trans_count += width + 1;
 }
 
@@ -879,10 +866,8 @@ void drawGenericBox ( FWidget* w, const FRect& r
   // Update area_changes for the top line
   auto y = y_offset + uInt(box.getY1());
   auto max_width = uInt(area.size.width + area.shadow.width) - 1;
-  area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
-  area_changes[y].xmin = std::min(area_changes[y].xmin, max_width);
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
-  area_changes[y].xmax = std::min(area_changes[y].xmax, max_width);
+  area_changes[y].mark ( std::min(x_offset + uInt(box.getX1()), max_width)
+                      , std::min(x_offset + uInt(box.getX2()), max_width) );
   area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
 
   // Draw the sides of the box
@@ -895,10 +880,8 @@ void drawGenericBox ( FWidget* w, const FRect& r
     fchar.ch[0] = box_char[4];
     *area_pos = fchar;
     // Update area_changes for the sides
-    area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
-    area_changes[y].xmin = std::min(area_changes[y].xmin, max_width);
-    area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
-    area_changes[y].xmax = std::min(area_changes[y].xmax, max_width);
+    area_changes[y].mark ( std::min(x_offset + uInt(box.getX1()), max_width)
+                        , std::min(x_offset + uInt(box.getX2()), max_width) );
     area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
   }
 
@@ -915,10 +898,8 @@ void drawGenericBox ( FWidget* w, const FRect& r
 
   // Update area_changes for the bottom line
   y = y_offset + uInt(box.getY2());
-  area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
-  area_changes[y].xmin = std::min(area_changes[y].xmin, max_width);
-  area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
-  area_changes[y].xmax = std::min(area_changes[y].xmax, max_width);
+  area_changes[y].mark ( std::min(x_offset + uInt(box.getX1()), max_width)
+                      , std::min(x_offset + uInt(box.getX2()), max_width) );
   area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
   area.has_changes = true;
 }
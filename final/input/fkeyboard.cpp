@@ -144,7 +144,7 @@ void FKeyboard::setNonBlockingInput (bool enable)
 //----------------------------------------------------------------------
 auto FKeyboard::hasUnprocessedInput() const noexcept -> bool
 {
-  return fifo_buf.hasData();
+  return fifo_buf.hasData() || hasUnreadBytes();
 }
 
 //----------------------------------------------------------------------
@@ -153,6 +153,9 @@ auto FKeyboard::isKeyPressed (uInt64 blocking_time) -> bool
   if ( has_pending_input )
     return false;
 
+  if ( hasUnreadBytes() )  // Bytes from the last read are still pending
+    return (has_pending_input = true);
+
   fd_set ifds{};
   struct timeval tv{};
   const int stdin_no = FTermios::getStdIn();
@@ -440,9 +443,19 @@ auto FKeyboard::UTF8decode (const std::size_t len) const noexcept -> FKey
 //----------------------------------------------------------------------
 inline auto FKeyboard::readKey() -> ssize_t
 {
+  // Reads all available input bytes into the read buffer
+
+  if ( hasUnreadBytes() )
+    return ssize_t(read_buf_len - read_buf_pos);
+
+  // The terminal shares one open file description for stdin and
+  // stdout, so O_NONBLOCK is only set for the duration of the read.
+  // Otherwise, terminal output could fail with EAGAIN.
   setNonBlockingInput();
-  const ssize_t bytes = read(FTermios::getStdIn(), &read_character, 1);
+  const ssize_t bytes = read(FTermios::getStdIn(), read_buf.data(), READ_BUF_SIZE);
   unsetNonBlockingInput();
+  read_buf_pos = 0;
+  read_buf_len = ( bytes > 0 ) ? std::size_t(bytes) : 0;
   return bytes;
 }
 
@@ -453,9 +466,26 @@ void FKeyboard::parseKeyBuffer()
   {
     time_keypressed = FObjectTimer::getCurrentTime();
     has_pending_input = false;
+    parseReadBuffer();
+
+    if ( fkey_queue.isFull() )
+      break;
+  }
+}
+
+//----------------------------------------------------------------------
+void FKeyboard::parseReadBuffer()
+{
+  // Feeds the read bytes one by one into the fifo buffer, so that
+  // fragmented key sequences are still recognized correctly
+
+  while ( hasUnreadBytes() && ! fkey_queue.isFull() )
+  {
+    const char ch = read_buf[read_buf_pos];
+    read_buf_pos++;
 
     if ( ! fifo_buf.isFull() )
-      fifo_buf.push(read_character);
+      fifo_buf.push(ch);
 
     // Read the rest from the fifo buffer
     while ( fifo_buf.hasData() && fkey != FKey::Incomplete )
@@ -477,9 +507,6 @@ void FKeyboard::parseKeyBuffer()
     }
 
     fkey = FKey::None;
-
-    if ( fkey_queue.isFull() )
-      break;
   }
 }
 
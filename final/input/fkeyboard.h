@@ -155,11 +155,13 @@ class FKeyboard final
     // Constants
     static constexpr FKey NOT_SET = static_cast<FKey>(-2);
     static constexpr std::size_t MAX_QUEUE_SIZE = 32;
+    static constexpr std::size_t READ_BUF_SIZE{4096};
 
     // Using-declaration
     using FKeyMapPtr = std::shared_ptr<FKeyMap::KeyCapMapType>;
     using KeyMapEnd = FKeyMap::KeyCapMapType::const_iterator;
     using KeyQueue = FRingBuffer<FKey, MAX_QUEUE_SIZE>;
+    using ReadBuffer = std::array<char, READ_BUF_SIZE>;
 
     // Accessors
     auto  getMouseProtocolKey() const -> FKey;
@@ -168,6 +170,7 @@ class FKeyboard final
     auto  getSingleKey() -> FKey;
 
     // Inquiry
+    auto  hasUnreadBytes() const noexcept -> bool;
     static auto isKeypressTimeout() -> bool;
     static auto isIntervalTimeout() -> bool;
 
@@ -175,6 +178,7 @@ class FKeyboard final
     auto  UTF8decode (const std::size_t) const noexcept -> FKey;
     auto  readKey() -> ssize_t;
     void  parseKeyBuffer();
+    void  parseReadBuffer();
     auto  parseKeyString() -> FKey;
     auto  keyCorrection (const FKey&) const -> FKey;
     void  substringKeyHandling();
@@ -197,11 +201,13 @@ class FKeyboard final
     FKeyMapPtr        key_cap_ptr{};
     KeyMapEnd         key_cap_end{};
     keybuffer         fifo_buf{};
+    ReadBuffer        read_buf{};
     KeyQueue          fkey_queue{};
     FKey              fkey{FKey::None};
     FKey              key{FKey::None};
     int               stdin_status_flags{0};
-    char              read_character{};
+    std::size_t       read_buf_pos{0};
+    std::size_t       read_buf_len{0};
     bool              has_pending_input{false};
     bool              fifo_in_use{false};
     bool              utf8_input{false};
@@ -281,6 +287,10 @@ inline auto FKeyboard::hasPendingInput() const noexcept -> bool
 inline auto FKeyboard::hasDataInQueue() const -> bool
 { return ! fkey_queue.isEmpty(); }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::hasUnreadBytes() const noexcept -> bool
+{ return read_buf_pos < read_buf_len; }
+
 //----------------------------------------------------------------------
 inline void FKeyboard::enableUTF8() noexcept
 { utf8_input = true; }
@@ -107,9 +107,7 @@ void FMenu::hide()
   if ( ! isVisible() )
     return;
 
-  FWindow::hide();
-  const auto& t_geometry = getTermGeometryWithShadow();
-  restoreVTerm (t_geometry);
+  FWindow::hide();  // Restores the terminal area below the menu
 
   if ( ! isSubMenu() )
   {
@@ -79,6 +79,7 @@ class FOutput : public std::enable_shared_from_this<FOutput>
     virtual auto getMaxColor() const -> int = 0;
     virtual auto getEncoding() const -> Encoding = 0;
     virtual auto getKeyName (FKey) const -> FString = 0;
+    virtual auto getTargetFrameRate() const -> uInt = 0;
 
     // Mutators
     virtual void setCursor (FPoint) = 0;
@@ -89,6 +90,7 @@ class FOutput : public std::enable_shared_from_this<FOutput>
     virtual auto setVGAFont() -> bool = 0;
     virtual auto setNewFont() -> bool = 0;
     virtual void setNonBlockingRead (bool = true) = 0;
+    virtual void setTargetFrameRate (uInt) = 0;
     template <typename ClassT>
     void         setColorPaletteTheme() const;
     template <typename ClassT>
@@ -116,6 +118,8 @@ class FOutput : public std::enable_shared_from_this<FOutput>
     virtual void initScreenSettings() = 0;
     virtual auto scrollTerminalForward() -> bool = 0;
     virtual auto scrollTerminalReverse() -> bool = 0;
+    virtual auto scrollTerminalRegionForward (const FRect&) -> bool = 0;
+    virtual auto scrollTerminalRegionReverse (const FRect&) -> bool = 0;
     virtual void clearTerminalAttributes() = 0;
     virtual void clearTerminalState() = 0;
     virtual auto clearTerminal (wchar_t = L' ') -> bool = 0;
@@ -23,6 +23,7 @@
 #include <strings.h>  // need for fss()
 
 #include <array>
+#include <climits>
 #include <cstring>
 #include <functional>
 #include <memory>
@@ -52,6 +53,215 @@ uInt8 var::b1_mask{};
 uInt8 var::b1_reset_mask{};
 uInt8 var::b2_reset_mask{};
 
+// SGR parameters to switch the attributes on and off
+// (bold, dim, italic, underline, blink, reverse, invisible,
+//  crossed out, double underline)
+constexpr std::array<uInt8, 9> sgr_on {{ 1,  2,  3,  4,  5,  7,  8,  9, 21}};
+constexpr std::array<uInt8, 9> sgr_off{{22, 22, 23, 24, 25, 27, 28, 29, 24}};
+constexpr uInt sgr_intensity_mask = 0x003;  // bold + dim
+constexpr uInt sgr_underline_mask = 0x108;  // underline + double underline
+
+// Standard VGA palette for the quantization of RGB colors
+constexpr std::array<std::array<uInt8, 3>, 16> vga_palette
+{{
+  {{0x00, 0x00, 0x00}}, {{0x00, 0x00, 0xaa}}, {{0x00, 0xaa, 0x00}},
+  {{0x00, 0xaa, 0xaa}}, {{0xaa, 0x00, 0x00}}, {{0xaa, 0x00, 0xaa}},
+  {{0xaa, 0x55, 0x00}}, {{0xaa, 0xaa, 0xaa}}, {{0x55, 0x55, 0x55}},
+  {{0x55, 0x55, 0xff}}, {{0x55, 0xff, 0x55}}, {{0x55, 0xff, 0xff}},
+  {{0xff, 0x55, 0x55}}, {{0xff, 0x55, 0xff}}, {{0xff, 0xff, 0x55}},
+  {{0xff, 0xff, 0xff}}
+}};
+
+// Channel values of the xterm 6x6x6 color cube
+constexpr std::array<uInt8, 6> cube_level{{0x00, 0x5f, 0x87, 0xaf, 0xd7, 0xff}};
+
+//----------------------------------------------------------------------
+// class SGRSequence
+//----------------------------------------------------------------------
+
+class SGRSequence
+{
+  public:
+    // Accessor
+    auto getLength() const noexcept -> std::size_t
+    {
+      return length;
+    }
+
+    // Inquiry
+    auto isEmpty() const noexcept -> bool
+    {
+      return length == 0;
+    }
+
+    // Methods
+    void add (uInt num) noexcept
+    {
+      // Appends a parameter (0...255) with hand-rolled decimal formatting
+
+      if ( length > 0 )
+        data[length++] = ';';
+
+      if ( num >= 100 )
+      {
+        data[length++] = char('0' + num / 100);
+        num %= 100;
+        data[length++] = char('0' + num / 10);
+        num %= 10;
+      }
+      else if ( num >= 10 )
+      {
+        data[length++] = char('0' + num / 10);
+        num %= 10;
+      }
+
+      data[length++] = char('0' + num);
+    }
+
+    void addColor (FColor color, uInt base) noexcept
+    {
+      // base = 30 for the foreground, 40 for the background color
+
+      if ( color == FColor::Default )
+      {
+        add (base + 9);
+        return;
+      }
+
+      if ( isRGBColor(color) )
+      {
+        add (base + 8);
+        add (2);
+        add (getRedValue(color));
+        add (getGreenValue(color));
+        add (getBlueValue(color));
+        return;
+      }
+
+      const auto index = uInt(FOptiAttr::vga2ansi(color));
+
+      if ( index < 8 )
+        add (base + index);
+      else if ( index < 16 )
+        add (base + 60 + index - 8);
+      else
+      {
+        add (base + 8);
+        add (5);
+        add (index);
+      }
+    }
+
+    void addAttributes (uInt attributes) noexcept
+    {
+      for (std::size_t i{0}; i < sgr_on.size(); i++)
+        if ( attributes & (1U << i) )
+          add (sgr_on[i]);
+    }
+
+    void appendTo (std::string& str) const
+    {
+      if ( isEmpty() )
+        return;
+
+      str.append(CSI);
+      str.append(data.data(), length);
+      str.push_back('m');
+    }
+
+  private:
+    // Data members
+    std::array<char, 96> data{};
+    std::size_t          length{0};
+};
+
+//----------------------------------------------------------------------
+inline auto getColorDistance ( int r1, int g1, int b1
+                              , int r2, int g2, int b2 ) noexcept -> int
+{
+  return (r1 - r2) * (r1 - r2)
+       + (g1 - g2) * (g1 - g2)
+       + (b1 - b2) * (b1 - b2);
+}
+
+//----------------------------------------------------------------------
+inline auto getCubeIndex (int value) noexcept -> int
+{
+  // Nearest channel level of the 6x6x6 color cube
+
+  if ( value < 48 )
+    return 0;
+
+  if ( value < 115 )
+    return 1;
+
+  return (value - 35) / 40;
+}
+
+//----------------------------------------------------------------------
+auto getNearest256Color (int r, int g, int b) noexcept -> uInt8
+{
+  // Compares the nearest color of the 6x6x6 cube (16-231)
+  // with the nearest gray level (232-255)
+
+  const int ri = getCubeIndex(r);
+  const int gi = getCubeIndex(g);
+  const int bi = getCubeIndex(b);
+  const int cube_distance = getColorDistance ( r, g, b
+                                             , cube_level[std::size_t(ri)]
+                                             , cube_level[std::size_t(gi)]
+                                             , cube_level[std::size_t(bi)] );
+  const int average = (r + g + b) / 3;
+  const int gray_index = ( average > 238 ) ? 23
+                       : ( average < 8 ) ? 0
+                       : (average - 3) / 10;
+  const int gray = 8 + 10 * gray_index;
+  const int gray_distance = getColorDistance (r, g, b, gray, gray, gray);
+
+  if ( gray_distance < cube_distance )
+    return uInt8(232 + gray_index);
+
+  return uInt8(16 + ri * 36 + gi * 6 + bi);
+}
+
+//----------------------------------------------------------------------
+auto getNearestVGAColor (int r, int g, int b, std::size_t colors) noexcept -> uInt8
+{
+  std::size_t nearest{0};
+  int min_distance{INT_MAX};
+
+  for (std::size_t i{0}; i < colors && i < vga_palette.size(); i++)
+  {
+    const auto& rgb = vga_palette[i];
+    const int distance = getColorDistance (r, g, b, rgb[0], rgb[1], rgb[2]);
+
+    if ( distance < min_distance )
+    {
+      min_distance = distance;
+      nearest = i;
+    }
+  }
+
+  return uInt8(nearest);
+}
+
+//----------------------------------------------------------------------
+inline auto getSGRAttributes (const FChar& fchar) noexcept -> uInt
+{
+  // The order of the bits corresponds to sgr_on and sgr_off
+
+  const auto& bit = fchar.attr.bit;
+  return uInt(bit.bold)
+       | uInt(bit.dim) << 1
+       | uInt(bit.italic) << 2
+       | uInt(bit.underline) << 3
+       | uInt(bit.blink) << 4
+       | uInt(bit.reverse || bit.standout) << 5
+       | uInt(bit.invisible) << 6
+       | uInt(bit.crossed_out) << 7
+       | uInt(bit.dbl_underline) << 8;
+}
+
 }  // namespace internal
 
 // Function prototypes
@@ -504,6 +714,7 @@ void FOptiAttr::initialize()
   init_reset_attribute (F_dbl_underline.off);
   init_reset_attribute (F_standout.off, all_tests & ~same_like_se);
   alt_equal_pc_charset = hasCharsetEquivalence();
+  transition_cache.clear();
 }
 
 //----------------------------------------------------------------------
@@ -541,50 +752,60 @@ auto FOptiAttr::vga2ansi (FColor color) -> FColor
       FColor(9), FColor(13), FColor(11), FColor(15)
     }};
 
-    color = lookup_table[uInt16(color)];
+    color = lookup_table[uInt32(color)];
   }
 
   return color;
 }
 
 //----------------------------------------------------------------------
-auto FOptiAttr::changeAttribute (FChar& term, FChar& next) -> std::string
+auto FOptiAttr::quantizeColor (FColor color) -> FColor
 {
-  const bool next_has_color = hasColor(next);
-  fake_reverse = false;
-  attr_buf.clear();
-  prevent_no_color_video_attributes (term, next_has_color);
-  prevent_no_color_video_attributes (next);
-  detectSwitchOn (term, next);
-  detectSwitchOff (term, next);
+  // Returns the nearest palette color of an RGB color
+  // from a lookup table with 5 bits per color channel
 
-  // Simulate invisible characters
-  if ( ! F_secure.on.cap && next.attr.bit.invisible )
-    next.encoded_char[0] = ' ';
+  if ( ! isRGBColor(color) )
+    return color;
 
-  // Look for no changes
-  if ( ! (switchOn() || switchOff() || hasColorChanged(term, next)) )
-    return {};
+  if ( palette_lut_colors != F_color.max_color )
+    init_palette_lookup_table();
 
-  if ( hasNoAttribute(next) )
-  {
-    deactivateAttributes (term, next);
-  }
-  else if ( F_attributes.on.cap
-         && (! term.attr.bit.pc_charset || alt_equal_pc_charset) )
-  {
-    changeAttributeSGR (term, next);
-  }
-  else
+  const auto index = uInt(getRedValue(color) >> 3) << 10
+                   | uInt(getGreenValue(color) >> 3) << 5
+                   | uInt(getBlueValue(color) >> 3);
+  return FColor(palette_lut[index]);
+}
+
+//----------------------------------------------------------------------
+auto FOptiAttr::changeAttribute (FChar& term, FChar& next) -> const std::string&
+{
+  // The generated sequence depends only on the two character states
+  // and the terminal environment, so transitions that have already
+  // been calculated are taken from the cache
+
+  static const auto& start_options = FStartOptions::getInstance();
+  const auto key = getTransitionKey(term, next, start_options.sgr_optimizer);
+  const auto iter = transition_cache.find(key);
+
+  if ( iter != transition_cache.end() )
   {
-    changeAttributeSeparately (term, next);
+    const auto& transition = iter->second;
+    term.fg_color = transition.term.fg_color;
+    term.bg_color = transition.term.bg_color;
+    term.attr = transition.term.attr;
+    next.fg_color = transition.next.fg_color;
+    next.bg_color = transition.next.bg_color;
+    next.attr.byte[0] = transition.next.attr.byte[0];
+    next.attr.byte[1] = transition.next.attr.byte[1];
+    return transition.sequence;
   }
 
-  static const auto& start_options = FStartOptions::getInstance();
+  createAttributeSequence (term, next);
 
-  if ( start_options.sgr_optimizer )
-    sgr_optimizer.optimize();
+  if ( transition_cache.size() >= MAX_TRANSITIONS )
+    transition_cache.clear();
 
+  transition_cache.emplace (key, Transition{attr_buf, term, next});
   return attr_buf;
 }
 
@@ -1034,6 +1255,21 @@ inline auto FOptiAttr::hasColorChanged ( const FChar& term
       || term.bg_color != next.bg_color;
 }
 
+//----------------------------------------------------------------------
+inline auto FOptiAttr::isDirectSGRUsable ( const FChar& term
+                                         , const FChar& next ) const -> bool
+{
+  // The pc charset and simulated reverse attributes need
+  // the termcap sequences
+
+  return direct_sgr
+      && ! F_color.monochron
+      && F_color.ansi_default_color
+      && ! fake_reverse
+      && ! term.attr.bit.pc_charset
+      && ! next.attr.bit.pc_charset;
+}
+
 //----------------------------------------------------------------------
 inline void FOptiAttr::resetColor (FChar& attr) const
 {
@@ -1069,6 +1305,60 @@ inline void FOptiAttr::prevent_no_color_video_attributes ( FChar& attr
   }
 }
 
+//----------------------------------------------------------------------
+auto FOptiAttr::getTransitionKey ( const FChar& term, const FChar& next
+                                 , bool sgr_optimization ) noexcept -> TransitionKey
+{
+  // The bytes #2 and #3 of the requested character
+  // are not involved in the attribute change
+
+  return { uInt64(term.fg_color) | uInt64(term.bg_color) << 32
+         , uInt64(next.fg_color) | uInt64(next.bg_color) << 32
+         , uInt64(term.attr.word)
+         | uInt64(next.attr.byte[0]) << 32
+         | uInt64(next.attr.byte[1]) << 40
+         | uInt64(sgr_optimization) << 48 };
+}
+
+//----------------------------------------------------------------------
+void FOptiAttr::createAttributeSequence (FChar& term, FChar& next)
+{
+  const bool next_has_color = hasColor(next);
+  fake_reverse = false;
+  attr_buf.clear();
+  prevent_no_color_video_attributes (term, next_has_color);
+  prevent_no_color_video_attributes (next);
+  detectSwitchOn (term, next);
+  detectSwitchOff (term, next);
+
+  // Look for no changes
+  if ( ! (switchOn() || switchOff() || hasColorChanged(term, next)) )
+    return;
+
+  if ( isDirectSGRUsable(term, next) )
+  {
+    changeAttributeDirect (term, next);
+  }
+  else if ( hasNoAttribute(next) )
+  {
+    deactivateAttributes (term, next);
+  }
+  else if ( F_attributes.on.cap
+         && (! term.attr.bit.pc_charset || alt_equal_pc_charset) )
+  {
+    changeAttributeSGR (term, next);
+  }
+  else
+  {
+    changeAttributeSeparately (term, next);
+  }
+
+  static const auto& start_options = FStartOptions::getInstance();
+
+  if ( start_options.sgr_optimizer )
+    sgr_optimizer.optimize();
+}
+
 //----------------------------------------------------------------------
 inline void FOptiAttr::deactivateAttributes (FChar& term, FChar& next)
 {
@@ -1140,6 +1430,80 @@ inline void FOptiAttr::changeAttributeSeparately (FChar& term, FChar& next)
   setAttributesOn(term);
 }
 
+//----------------------------------------------------------------------
+void FOptiAttr::changeAttributeDirect (FChar& term, FChar& next)
+{
+  // Creates a single ECMA-48 SGR sequence from the attribute
+  // differences without termcap parameterization
+
+  normalizeColor (next.fg_color);
+  normalizeColor (next.bg_color);
+  const auto have = internal::getSGRAttributes(term);
+  const auto want = internal::getSGRAttributes(next);
+  auto off = have & ~want;
+  auto on = want & ~have;
+  internal::SGRSequence changed{};
+
+  // The parameters 22 and 24 switch off two attributes at once
+  if ( off & internal::sgr_intensity_mask )
+  {
+    changed.add (22);
+    on |= want & internal::sgr_intensity_mask;
+    off &= ~internal::sgr_intensity_mask;
+  }
+
+  if ( off & internal::sgr_underline_mask )
+  {
+    changed.add (24);
+    on |= want & internal::sgr_underline_mask;
+    off &= ~internal::sgr_underline_mask;
+  }
+
+  for (std::size_t i{0}; i < internal::sgr_off.size(); i++)
+    if ( off & (1U << i) )
+      changed.add (internal::sgr_off[i]);
+
+  changed.addAttributes (on);
+
+  if ( term.fg_color != next.fg_color )
+    changed.addColor (next.fg_color, 30);
+
+  if ( term.bg_color != next.bg_color )
+    changed.addColor (next.bg_color, 40);
+
+  if ( have & ~want )
+  {
+    // Compare with a reset of all attributes
+    internal::SGRSequence reset{};
+    reset.add (0);
+    reset.addAttributes (want);
+
+    if ( next.fg_color != FColor::Default )
+      reset.addColor (next.fg_color, 30);
+
+    if ( next.bg_color != FColor::Default )
+      reset.addColor (next.bg_color, 40);
+
+    if ( reset.getLength() < changed.getLength() )
+      changed = reset;
+  }
+
+  changed.appendTo (attr_buf);
+  term.attr.byte[0] = next.attr.byte[0];
+  term.attr.bit.protect = next.attr.bit.protect;
+  term.attr.bit.crossed_out = next.attr.bit.crossed_out;
+  term.attr.bit.dbl_underline = next.attr.bit.dbl_underline;
+  term.fg_color = next.fg_color;
+  term.bg_color = next.bg_color;
+
+  // The alternate character set is not part of SGR
+  if ( changes.off.attr.bit.alt_charset )
+    unsetTermAltCharset (term);
+
+  if ( changes.on.attr.bit.alt_charset )
+    setTermAltCharset (term);
+}
+
 //----------------------------------------------------------------------
 void FOptiAttr::change_color (FChar& term, FChar& next)
 {
@@ -1171,12 +1535,63 @@ void FOptiAttr::change_color (FChar& term, FChar& next)
 }
 
 //----------------------------------------------------------------------
-inline void FOptiAttr::normalizeColor (FColor& color) const noexcept
+inline void FOptiAttr::normalizeColor (FColor& color)
 {
-  if ( color != FColor::Default )
+  if ( isRGBColor(color) )
+  {
+    // Without 24-bit color support, RGB colors are
+    // mapped to the nearest palette color
+    if ( ! F_color.truecolor )
+      color = quantizeColor(color);
+  }
+  else if ( color != FColor::Default )
     color %= uInt16(F_color.max_color);
 }
 
+//----------------------------------------------------------------------
+void FOptiAttr::init_palette_lookup_table()
+{
+  // The table is calculated once for the current number of colors
+
+  constexpr std::size_t channel_values = 32;
+  palette_lut.resize (channel_values * channel_values * channel_values);
+  auto iter = palette_lut.begin();
+
+  for (int r5{0}; r5 < int(channel_values); r5++)
+  {
+    const int r = (r5 << 3) | (r5 >> 2);
+
+    for (int g5{0}; g5 < int(channel_values); g5++)
+    {
+      const int g = (g5 << 3) | (g5 >> 2);
+
+      for (int b5{0}; b5 < int(channel_values); b5++)
+      {
+        const int b = (b5 << 3) | (b5 >> 2);
+
+        if ( F_color.max_color >= 256 )
+          *iter = internal::getNearest256Color(r, g, b);
+        else
+          *iter = internal::getNearestVGAColor(r, g, b, std::size_t(F_color.max_color));
+
+        ++iter;
+      }
+    }
+  }
+
+  palette_lut_colors = F_color.max_color;
+}
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::appendRGBColor (FColor color, uInt base)
+{
+  // 24-bit color sequence (base = 30 for foreground, 40 for background)
+
+  internal::SGRSequence rgb{};
+  rgb.addColor (color, base);
+  rgb.appendTo (attr_buf);
+}
+
 //----------------------------------------------------------------------
 inline void FOptiAttr::handleDefaultColors ( FChar& term, FChar& next
                                            , FColor& fg, FColor& bg )
@@ -1256,10 +1671,20 @@ inline void FOptiAttr::change_current_color ( const FChar& term
     const auto bg_value = ( cm == VGA ) ? uInt16(vga2ansi(bg)) : uInt16(bg);
 
     if ( has_foreground_changes(term, fg, frev) )
-      append_sequence(FTermcap::encodeParameter(fg_cap, fg_value));
+    {
+      if ( isRGBColor(fg) )
+        appendRGBColor (fg, 30);
+      else
+        append_sequence(FTermcap::encodeParameter(fg_cap, fg_value));
+    }
 
     if ( has_background_changes(term, bg, frev) )
-      append_sequence(FTermcap::encodeParameter(bg_cap, bg_value));
+    {
+      if ( isRGBColor(bg) )
+        appendRGBColor (bg, 40);
+      else
+        append_sequence(FTermcap::encodeParameter(bg_cap, bg_value));
+    }
 
     return true;
   };
@@ -39,6 +39,8 @@
 #include <algorithm>  // need for std::swap
 #include <array>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "final/ftypes.h"
 #include "final/output/tty/sgr_optimizer.h"
@@ -106,6 +108,10 @@ class FOptiAttr final
     void        setNoColorVideo (int) noexcept;
     void        setDefaultColorSupport() noexcept;
     void        unsetDefaultColorSupport() noexcept;
+    void        setDirectSGRSupport() noexcept;
+    void        unsetDirectSGRSupport() noexcept;
+    void        setTrueColorSupport() noexcept;
+    void        unsetTrueColorSupport() noexcept;
     void        set_enter_bold_mode (const char[]);
     void        set_exit_bold_mode (const char[]);
     void        set_enter_dim_mode (const char[]);
@@ -142,13 +148,15 @@ class FOptiAttr final
     void        set_orig_pair (const char[]);
     void        set_orig_colors (const char[]);
 
-    // Inquiry
+    // Inquiries
     static auto isNormal (const FChar&) -> bool;
+    auto        isInvisibleSimulated (const FChar&) const -> bool;
 
     // Methods
     void        initialize();
     static auto vga2ansi (FColor) -> FColor;
-    auto        changeAttribute (FChar&, FChar&) -> std::string;
+    auto        quantizeColor (FColor) -> FColor;
+    auto        changeAttribute (FChar&, FChar&) -> const std::string&;
 
   private:
     struct Capability
@@ -176,6 +184,7 @@ class FOptiAttr final
       int          max_color{1};
       bool         monochron{true};
       bool         ansi_default_color{false};
+      bool         truecolor{false};
     };
 
     struct AttributeChanges
@@ -184,6 +193,38 @@ class FOptiAttr final
       FChar off{};
     };
 
+    struct TransitionKey
+    {
+      uInt64 term{0};  // Colors of the terminal
+      uInt64 next{0};  // Requested colors
+      uInt64 attr{0};  // Attributes and SGR optimization
+
+      friend auto operator == ( const TransitionKey& lhs
+                              , const TransitionKey& rhs ) noexcept -> bool
+      {
+        return lhs.term == rhs.term
+            && lhs.next == rhs.next
+            && lhs.attr == rhs.attr;
+      }
+    };
+
+    struct TransitionKeyHash
+    {
+      auto operator () (const TransitionKey& key) const noexcept -> std::size_t
+      {
+        return std::hash<uInt64>{}(key.term)
+             ^ (std::hash<uInt64>{}(key.next) << 1)
+             ^ (std::hash<uInt64>{}(key.attr) << 2);
+      }
+    };
+
+    struct Transition
+    {
+      std::string sequence{};
+      FChar       term{};  // Terminal state after the change
+      FChar       next{};  // Normalized requested state
+    };
+
     // Using-declarations
     using SetFunctionCall = std::function<bool(FOptiAttr*, FChar&)>;
 
@@ -196,6 +237,13 @@ class FOptiAttr final
     using AttributeHandlers = std::array<AttributeHandlerEntry, 13>;
     using NoColorVideoHandler = std::function<void(FOptiAttr*, FChar&)>;
     using NoColorVideoHandlerTable = std::array<NoColorVideoHandler, 18>;
+    using TransitionCache = std::unordered_map< TransitionKey
+                                              , Transition
+                                              , TransitionKeyHash >;
+    using PaletteTable = std::vector<uInt8>;
+
+    // Constant
+    static constexpr std::size_t MAX_TRANSITIONS = 1024;
 
     // Enumerations
     enum init_reset_tests
@@ -254,15 +302,21 @@ class FOptiAttr final
     auto        isPCcharsetUsed (const FChar&, const FChar&) const -> bool;
     auto        isPCcharsetUsable (FChar&, const FChar&) -> bool;
     auto        hasColorChanged (const FChar&, const FChar&) const -> bool;
+    auto        isDirectSGRUsable (const FChar&, const FChar&) const -> bool;
 
     // Methods
     void        resetColor (FChar&) const;
     void        prevent_no_color_video_attributes (FChar&, bool = false);
+    static auto getTransitionKey (const FChar&, const FChar&, bool) noexcept -> TransitionKey;
+    void        createAttributeSequence (FChar&, FChar&);
     void        deactivateAttributes (FChar&, FChar&);
     void        changeAttributeSGR (FChar&, FChar&);
     void        changeAttributeSeparately (FChar&, FChar&);
+    void        changeAttributeDirect (FChar&, FChar&);
     void        change_color (FChar&, FChar&);
-    void        normalizeColor (FColor&) const noexcept;
+    void        normalizeColor (FColor&);
+    void        init_palette_lookup_table();
+    void        appendRGBColor (FColor, uInt);
     void        handleDefaultColors (FChar&, FChar&, FColor&, FColor&);
     void        change_to_default_color (FChar&, FChar&, FColor&, FColor&);
     void        setDefaultForeground (FChar&);
@@ -311,10 +365,14 @@ class FOptiAttr final
     ColorStyle       F_color{};
 
     AttributeChanges changes{};
+    TransitionCache  transition_cache{};
+    PaletteTable     palette_lut{};  // RGB555 to palette index
+    int              palette_lut_colors{0};
     std::string      attr_buf{};
     SGRoptimizer     sgr_optimizer{attr_buf};
     bool             alt_equal_pc_charset{false};
     bool             fake_reverse{false};
+    bool             direct_sgr{false};
 };
 
 
@@ -325,19 +383,67 @@ inline auto FOptiAttr::getClassName() const -> FString
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::setMaxColor (const int& c) noexcept
-{ F_color.max_color = c; }
+{
+  F_color.max_color = c;
+  transition_cache.clear();
+}
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::setNoColorVideo (int attr) noexcept
-{ F_color.attr_without_color = attr; }
+{
+  F_color.attr_without_color = attr;
+  transition_cache.clear();
+}
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::setDefaultColorSupport() noexcept
-{ F_color.ansi_default_color = true; }
+{
+  F_color.ansi_default_color = true;
+  transition_cache.clear();
+}
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::unsetDefaultColorSupport() noexcept
-{ F_color.ansi_default_color = false; }
+{
+  F_color.ansi_default_color = false;
+  transition_cache.clear();
+}
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::setDirectSGRSupport() noexcept
+{
+  direct_sgr = true;
+  transition_cache.clear();
+}
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::unsetDirectSGRSupport() noexcept
+{
+  direct_sgr = false;
+  transition_cache.clear();
+}
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::setTrueColorSupport() noexcept
+{
+  F_color.truecolor = true;
+  transition_cache.clear();
+}
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::unsetTrueColorSupport() noexcept
+{
+  F_color.truecolor = false;
+  transition_cache.clear();
+}
+
+//----------------------------------------------------------------------
+inline auto FOptiAttr::isInvisibleSimulated (const FChar& fchar) const -> bool
+{
+  // Without a secure mode capability, invisible characters
+  // are simulated by printing a space
+  return ! F_secure.on.cap && fchar.attr.bit.invisible;
+}
 
 //----------------------------------------------------------------------
 template <typename CharT
@@ -341,6 +341,8 @@ void FOptiMove::set_parm_up_cursor (const char cap[])
     parm_cursor.up.duration = \
     parm_cursor.up.length   = LONG_DURATION;
   }
+
+  calculateParmSequences (parm_sequences.up, parm_cursor.up.cap);
 }
 
 //----------------------------------------------------------------------
@@ -359,6 +361,8 @@ void FOptiMove::set_parm_down_cursor (const char cap[])
     parm_cursor.down.duration = \
     parm_cursor.down.length   = LONG_DURATION;
   }
+
+  calculateParmSequences (parm_sequences.down, parm_cursor.down.cap);
 }
 
 //----------------------------------------------------------------------
@@ -377,6 +381,8 @@ void FOptiMove::set_parm_left_cursor (const char cap[])
     parm_cursor.left.duration = \
     parm_cursor.left.length   = LONG_DURATION;
   }
+
+  calculateParmSequences (parm_sequences.left, parm_cursor.left.cap);
 }
 
 //----------------------------------------------------------------------
@@ -395,6 +401,8 @@ void FOptiMove::set_parm_right_cursor (const char cap[])
     parm_cursor.right.duration = \
     parm_cursor.right.length   = LONG_DURATION;
   }
+
+  calculateParmSequences (parm_sequences.right, parm_cursor.right.cap);
 }
 
 //----------------------------------------------------------------------
@@ -502,49 +510,29 @@ void FOptiMove::check_boundaries ( int& xold, int& yold
 }
 
 //----------------------------------------------------------------------
-auto FOptiMove::moveCursor (int xold, int yold, int xnew, int ynew) -> std::string
+auto FOptiMove::moveCursor (int xold, int yold, int xnew, int ynew) -> const std::string&
 {
-  int method{0};
   int move_time{LONG_DURATION};
-
   check_boundaries (xold, yold, xnew, ynew);
 
-  // Method 0: direct cursor addressing
-  if ( isMethod0Faster(move_time, xnew, ynew)
-    && ( xold < 0
-      || yold < 0
-      || isWideMove (xold, yold, xnew, ynew) ) )
+  // Only the durations are compared, the escape sequence
+  // is created for the fastest method only
+  int method = getFastestMethod (move_time, xold, yold, xnew, ynew, true);
+
+  if ( method == 0 && move_time < LONG_DURATION
+    && ! moveWithAddress(xnew, ynew) )
   {
-    return ( move_time < LONG_DURATION ) ? move_buf : std::string{};
+    // Direct cursor addressing is not encodable for this position
+    method = getFastestMethod (move_time, xold, yold, xnew, ynew, false);
   }
 
-  // Method 1: local movement
-  if ( isMethod1Faster(move_time, xold, yold, xnew, ynew) )
-    method = 1;
-
-  // Method 2: carriage-return + local movement
-  if ( isMethod2Faster(move_time, yold, xnew, ynew) )
-    method = 2;
-
-  // Method 3: home-cursor + local movement
-  if ( isMethod3Faster(move_time, xnew, ynew) )
-    method = 3;
-
-  // Method 4: home-down + local movement
-  if ( isMethod4Faster(move_time, xnew, ynew) )
-    method = 4;
-
-  // Method 5: left margin for wrap to right-hand side
-  if ( isMethod5Faster(move_time, yold, xnew, ynew) )
-    method = 5;
-
   // Copy the escape sequence for the chosen method in move_buf
-  moveByMethod (method, xold, yold, xnew, ynew);
-
   if ( move_time < LONG_DURATION )
-    return move_buf;
+    moveByMethod (method, xold, yold, xnew, ynew);
+  else
+    move_buf.clear();
 
-  return {};
+  return move_buf;
 }
 
 
@@ -629,271 +617,228 @@ auto FOptiMove::capDurationToLength (int duration) const -> int
 }
 
 //----------------------------------------------------------------------
-auto FOptiMove::repeatedAppend ( std::string& dst
-                               , const Capability& o
-                               , int count ) const -> int
+void FOptiMove::calculateParmSequences (SequenceTable& table, const char cap[])
 {
-  const auto& src_len = stringLength(o.cap);
-  const auto& dst_len = dst.length();
-  int total{0};
-
-  if ( (dst_len + uInt(count) * src_len) < BUF_SIZE - 1 )
-  {
-    total += count * o.duration;
-    int cnt = count;
-
-    while ( cnt > 0 )
-    {
-      cnt--;
-      dst.append(o.cap);
-    }
-  }
-  else
-    total = LONG_DURATION;
+  // Encodes the parameterized cursor movements for small distances
 
-  return total;
+  for (std::size_t num{1}; num < table.size(); num++)
+    table[num] = cap ? FTermcap::encodeParameter(cap, num) : std::string{};
 }
 
 //----------------------------------------------------------------------
-auto FOptiMove::relativeMove ( std::string& move
-                             , int from_x, int from_y
-                             , int to_x, int to_y ) const -> int
+auto FOptiMove::repeatedDuration ( const Capability& o
+                                 , int count
+                                 , std::size_t used_length ) -> int
 {
-  int vtime{0};
-  int htime{0};
+  // Duration of count repetitions behind used_length characters
 
-  if ( ! move.empty() )
-    move.clear();
-
-  if ( to_y != from_y )  // vertical move
-  {
-    vtime = verticalMove (move, from_y, to_y);
+  if ( used_length + uInt(count) * stringLength(o.cap) < BUF_SIZE - 1 )
+    return count * o.duration;
 
-    if ( vtime >= LONG_DURATION )
-      return LONG_DURATION;
-  }
+  return LONG_DURATION;
+}
 
-  if ( to_x != from_x )  // horizontal move
+//----------------------------------------------------------------------
+void FOptiMove::repeatedAppend ( std::string& dst
+                               , const Capability& o
+                               , int count )
+{
+  while ( count > 0 )
   {
-    std::string hmove{};
-    htime = horizontalMove (hmove, from_x, to_x);
-
-    if ( htime >= LONG_DURATION )
-      return LONG_DURATION;
-
-    if ( ! move.empty() )
-      move.append(hmove);
-    else
-      move = std::move(hmove);
+    count--;
+    dst.append(o.cap);
   }
+}
 
-  return vtime + htime;
+//----------------------------------------------------------------------
+void FOptiMove::parameterizedAppend ( std::string& dst
+                                    , const Capability& o
+                                    , const SequenceTable& table
+                                    , int num )
+{
+  if ( std::size_t(num) < table.size() )
+    dst.append(table[std::size_t(num)]);
+  else
+    dst.append(FTermcap::encodeParameter(o.cap, num));
 }
 
 //----------------------------------------------------------------------
-inline auto FOptiMove::verticalMove (std::string& move, int from_y, int to_y) const -> int
+auto FOptiMove::relativeMoveDuration ( int from_x, int from_y
+                                     , int to_x, int to_y ) const -> int
 {
-  int vtime{LONG_DURATION};
+  const auto vtime = verticalMotion(from_y, to_y).duration;
 
-  if ( parm_cursor.row_address.cap )
-  {
-    // Move to fixed row position
-    move = FTermcap::encodeParameter(parm_cursor.row_address.cap, to_y);
-    vtime = parm_cursor.row_address.duration;
-  }
+  if ( vtime >= LONG_DURATION )
+    return LONG_DURATION;
 
-  if ( to_y > from_y )
-    downMove (move, vtime, from_y, to_y);
-  else  // to_y < from_y
-    upMove (move, vtime, from_y, to_y);
+  const auto htime = horizontalMotion(from_x, to_x).duration;
 
-  return vtime;
+  if ( htime >= LONG_DURATION )
+    return LONG_DURATION;
+
+  return vtime + htime;
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::downMove ( std::string& move, int& vtime
-                                , int from_y, int to_y ) const
+void FOptiMove::relativeMove ( std::string& move
+                             , int from_x, int from_y
+                             , int to_x, int to_y ) const
 {
-  const int num = to_y - from_y;
-
-  if ( parm_cursor.down.cap && parm_cursor.down.duration < vtime )
-  {
-    move = FTermcap::encodeParameter(parm_cursor.down.cap, num);
-    vtime = parm_cursor.down.duration;
-  }
-
-  if ( cursor.down.cap && (num * cursor.down.duration < vtime) )
-  {
-    if ( ! move.empty() )
-      move.clear();
+  // Appends the fastest local movement to move
 
-    vtime = repeatedAppend (move, cursor.down, num);
-  }
+  verticalMove (move, verticalMotion(from_y, to_y), from_y, to_y);
+  horizontalMove (move, horizontalMotion(from_x, to_x), from_x, to_x);
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::upMove ( std::string& move, int& vtime
-                              , int from_y, int to_y ) const
+auto FOptiMove::verticalMotion (int from_y, int to_y) const -> Motion
 {
-  const int num = from_y - to_y;
+  if ( to_y == from_y )
+    return {MotionType::None, 0, 0, 0};
 
-  if ( parm_cursor.up.cap && parm_cursor.up.duration < vtime )
-  {
-    move = FTermcap::encodeParameter(parm_cursor.up.cap, num);
-    vtime = parm_cursor.up.duration;
-  }
+  const bool down = to_y > from_y;
+  const auto& step = down ? cursor.down : cursor.up;
+  const auto& parm = down ? parm_cursor.down : parm_cursor.up;
+  const int num = std::abs(to_y - from_y);
+  Motion motion{};
 
-  if ( cursor.up.cap && (num * cursor.up.duration < vtime) )
-  {
-    if ( ! move.empty() )
-      move.clear();
+  if ( parm_cursor.row_address.cap )  // Move to fixed row position
+    motion = {MotionType::Address, parm_cursor.row_address.duration, 0, 0};
 
-    vtime = repeatedAppend (move, cursor.up, num);
-  }
+  if ( parm.cap && parm.duration < motion.duration )
+    motion = {MotionType::Parameterized, parm.duration, num, 0};
+
+  if ( step.cap && num * step.duration < motion.duration )
+    motion = {MotionType::Repeated, repeatedDuration(step, num, 0), num, 0};
+
+  return motion;
 }
 
 //----------------------------------------------------------------------
-inline auto FOptiMove::horizontalMove (std::string& hmove, int from_x, int to_x) const -> int
+auto FOptiMove::horizontalMotion (int from_x, int to_x) const -> Motion
 {
-  int htime{LONG_DURATION};
+  if ( to_x == from_x )
+    return {MotionType::None, 0, 0, 0};
+
+  const bool right = to_x > from_x;
+  const auto& step = right ? cursor.right : cursor.left;
+  const auto& parm = right ? parm_cursor.right : parm_cursor.left;
+  const int num = std::abs(to_x - from_x);
+  Motion motion{};
+
+  if ( parm_cursor.column_address.cap )  // Move to fixed column position
+    motion = {MotionType::Address, parm_cursor.column_address.duration, 0, 0};
 
-  if ( parm_cursor.column_address.cap )
+  if ( parm.cap && parm.duration < motion.duration )
+    motion = {MotionType::Parameterized, parm.duration, num, 0};
+
+  if ( step.cap )
   {
-    // Move to fixed column position
-    hmove = FTermcap::encodeParameter(parm_cursor.column_address.cap, to_x);
-    htime = parm_cursor.column_address.duration;
-  }
+    const auto stepped = steppedMotion(from_x, to_x);
 
-  if ( to_x > from_x )
-    rightMove (hmove, htime, from_x, to_x);
-  else  // to_x < from_x
-    leftMove (hmove, htime, from_x, to_x);
+    if ( stepped.duration < motion.duration )
+      motion = stepped;
+  }
 
-  return htime;
+  return motion;
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithParmRightCursor ( std::string& hmove
-                                               , int& htime, int num ) const
+auto FOptiMove::steppedMotion (int from_x, int to_x) const -> Motion
 {
-  // Use parameterized cursor right capability
-  hmove = FTermcap::encodeParameter(parm_cursor.right.cap, num);
-  htime = parm_cursor.right.duration;
-}
+  // Movement with (back) tabs and single cursor steps
 
-//----------------------------------------------------------------------
-inline void FOptiMove::moveWithRightCursor ( std::string& hmove, int& htime
-                                           , int num, int from_x, int to_x ) const
-{
-  std::string str{};
-  int htime_r{0};
+  const bool right = to_x > from_x;
+  const auto& tab = right ? cursor.tab : cursor.back_tab;
+  const auto& step = right ? cursor.right : cursor.left;
+  Motion motion{MotionType::Repeated, 0, 0, 0};
+  std::size_t length{0};
+  int pos = from_x;
 
-  // try to use tab
-  if ( tabstop > 0 && cursor.tab.cap )
+  if ( tabstop > 0 && tab.cap )
   {
-    int pos = from_x;
+    const auto tab_length = stringLength(tab.cap);
 
-    for ( int tab_pos = pos + tabstop - (pos % tabstop)
-        ; tab_pos <= to_x
-        ; tab_pos += tabstop )
+    for ( int tab_pos = nextTabPosition(pos, right)
+        ; right ? tab_pos <= to_x : tab_pos >= to_x
+        ; tab_pos = nextTabPosition(pos, right) )
     {
-      htime_r += repeatedAppend (str, cursor.tab, 1);
+      const auto tab_time = repeatedDuration (tab, 1, length);
 
-      if ( htime_r >= LONG_DURATION )
-        break;
+      if ( tab_time >= LONG_DURATION )
+        return {};
 
+      motion.duration += tab_time;
+      motion.tabs++;
+      length += tab_length;
       pos = tab_pos;
     }
-
-    num = to_x - pos;
-  }
-
-  // Use the cursor right capability
-  htime_r += repeatedAppend (str, cursor.right, num);
-
-  if ( htime_r < htime )
-  {
-    hmove = std::move(str);
-    htime = htime_r;
   }
-}
-
-//----------------------------------------------------------------------
-inline void FOptiMove::rightMove ( std::string& hmove, int& htime
-                                 , int from_x, int to_x ) const
-{
-  int num = to_x - from_x;
 
-  if ( num == 0 )
-    return;
+  motion.count = std::abs(to_x - pos);
+  const auto step_time = repeatedDuration (step, motion.count, length);
 
-  if ( parm_cursor.right.cap && parm_cursor.right.duration < htime )
-    moveWithParmRightCursor (hmove, htime, num);
+  if ( step_time >= LONG_DURATION )
+    return {};
 
-  if ( cursor.right.cap )
-    moveWithRightCursor (hmove, htime, num, from_x, to_x);
+  motion.duration += step_time;
+  return motion;
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithParmLeftCursor ( std::string& hmove
-                                              , int& htime, int num ) const
+inline auto FOptiMove::nextTabPosition (int pos, bool forward) const -> int
 {
-  // Use parameterized cursor right capability
-  hmove = FTermcap::encodeParameter(parm_cursor.left.cap, num);
-  htime = parm_cursor.left.duration;
+  if ( forward )
+    return pos + tabstop - (pos % tabstop);
+
+  return ( pos > 0 ) ? ((pos - 1) / tabstop) * tabstop : -1;
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithLeftCursor ( std::string& hmove, int& htime
-                                          , int num, int from_x, int to_x ) const
+inline void FOptiMove::verticalMove ( std::string& move, const Motion& motion
+                                    , int from_y, int to_y ) const
 {
-  std::string str{};
-  int htime_l{0};
+  const bool down = to_y > from_y;
 
-  // try to use backward tab
-  if ( tabstop > 0 && cursor.back_tab.cap )
+  if ( motion.type == MotionType::Address )
   {
-    int pos = from_x;
-
-    for ( int tab_pos = ( pos > 0 ) ? ((pos - 1) / tabstop) * tabstop : -1
-        ; tab_pos >= to_x
-        ; tab_pos = ( pos > 0 ) ? ((pos - 1) / tabstop) * tabstop : -1)
-    {
-      htime_l += repeatedAppend (str, cursor.back_tab, 1);
-
-      if ( htime_l >= LONG_DURATION )
-        break;
-
-      pos = tab_pos;
-    }
-
-    num = pos - to_x;
+    move.append(FTermcap::encodeParameter(parm_cursor.row_address.cap, to_y));
   }
-
-  // Use the cursor left capability
-  htime_l += repeatedAppend (str, cursor.left, num);
-
-  if ( htime_l < htime )
+  else if ( motion.type == MotionType::Parameterized )
   {
-    hmove = std::move(str);
-    htime = htime_l;
+    parameterizedAppend ( move
+                        , down ? parm_cursor.down : parm_cursor.up
+                        , down ? parm_sequences.down : parm_sequences.up
+                        , motion.count );
+  }
+  else if ( motion.type == MotionType::Repeated )
+  {
+    repeatedAppend (move, down ? cursor.down : cursor.up, motion.count);
   }
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::leftMove ( std::string& hmove, int& htime
-                                , int from_x, int to_x ) const
+inline void FOptiMove::horizontalMove ( std::string& move, const Motion& motion
+                                      , int from_x, int to_x ) const
 {
-  int num = from_x - to_x;
-
-  if ( num == 0 )
-    return;
+  const bool right = to_x > from_x;
 
-  if ( parm_cursor.left.cap && parm_cursor.left.duration < htime )
-    moveWithParmLeftCursor (hmove, htime, num);
-
-  if ( cursor.left.cap )
-    moveWithLeftCursor (hmove, htime, num, from_x, to_x);
+  if ( motion.type == MotionType::Address )
+  {
+    move.append(FTermcap::encodeParameter(parm_cursor.column_address.cap, to_x));
+  }
+  else if ( motion.type == MotionType::Parameterized )
+  {
+    parameterizedAppend ( move
+                        , right ? parm_cursor.right : parm_cursor.left
+                        , right ? parm_sequences.right : parm_sequences.left
+                        , motion.count );
+  }
+  else if ( motion.type == MotionType::Repeated )
+  {
+    repeatedAppend (move, right ? cursor.tab : cursor.back_tab, motion.tabs);
+    repeatedAppend (move, right ? cursor.right : cursor.left, motion.count);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -906,37 +851,69 @@ inline auto FOptiMove::isWideMove ( int xold, int yold
 }
 
 //----------------------------------------------------------------------
-inline auto FOptiMove::isMethod0Faster ( int& move_time
-                                       , int xnew, int ynew ) -> bool
+auto FOptiMove::getFastestMethod ( int& move_time
+                                 , int xold, int yold
+                                 , int xnew, int ynew
+                                 , bool use_address ) const -> int
+{
+  int method{0};
+  move_time = LONG_DURATION;
+
+  // Method 0: direct cursor addressing
+  if ( use_address
+    && isMethod0Faster(move_time)
+    && ( xold < 0
+      || yold < 0
+      || isWideMove (xold, yold, xnew, ynew) ) )
+  {
+    return method;
+  }
+
+  // Method 1: local movement
+  if ( isMethod1Faster(move_time, xold, yold, xnew, ynew) )
+    method = 1;
+
+  // Method 2: carriage-return + local movement
+  if ( isMethod2Faster(move_time, yold, xnew, ynew) )
+    method = 2;
+
+  // Method 3: home-cursor + local movement
+  if ( isMethod3Faster(move_time, xnew, ynew) )
+    method = 3;
+
+  // Method 4: home-down + local movement
+  if ( isMethod4Faster(move_time, xnew, ynew) )
+    method = 4;
+
+  // Method 5: left margin for wrap to right-hand side
+  if ( isMethod5Faster(move_time, yold, xnew, ynew) )
+    method = 5;
+
+  return method;
+}
+
+//----------------------------------------------------------------------
+inline auto FOptiMove::isMethod0Faster (int& move_time) const -> bool
 {
   // Test method 0: direct cursor addressing
 
   if ( ! parm_cursor.address.cap )
     return false;
 
-  const auto move_xy = \
-    FTermcap::encodeMotionParameter(parm_cursor.address.cap, xnew, ynew);
-
-  if ( ! move_xy.empty() )
-  {
-    move_buf = move_xy;
-    move_time = parm_cursor.address.duration;
-    return true;
-  }
-
-  return false;
+  move_time = parm_cursor.address.duration;
+  return true;
 }
 
 //----------------------------------------------------------------------
 inline auto FOptiMove::isMethod1Faster ( int& move_time
                                        , int xold, int yold
-                                       , int xnew, int ynew ) -> bool
+                                       , int xnew, int ynew ) const -> bool
 {
   // Test method 1: local movement
 
   if ( xold >= 0 && yold >= 0 )
   {
-    const int new_time = relativeMove (temp_result, xold, yold, xnew, ynew);
+    const int new_time = relativeMoveDuration (xold, yold, xnew, ynew);
 
     if ( new_time < LONG_DURATION && new_time < move_time )
     {
@@ -951,13 +928,13 @@ inline auto FOptiMove::isMethod1Faster ( int& move_time
 //----------------------------------------------------------------------
 inline auto FOptiMove::isMethod2Faster ( int& move_time
                                        , int yold
-                                       , int xnew, int ynew ) -> bool
+                                       , int xnew, int ynew ) const -> bool
 {
   // Test method 2: carriage-return + local movement
 
   if ( yold >= 0 && cursor.carriage_return.cap )
   {
-    const int new_time = relativeMove (temp_result, 0, yold, xnew, ynew);
+    const int new_time = relativeMoveDuration (0, yold, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.carriage_return.duration + new_time < move_time )
@@ -972,13 +949,13 @@ inline auto FOptiMove::isMethod2Faster ( int& move_time
 
 //----------------------------------------------------------------------
 inline auto FOptiMove::isMethod3Faster ( int& move_time
-                                       , int xnew, int ynew ) -> bool
+                                       , int xnew, int ynew ) const -> bool
 {
   // Test method 3: home-cursor + local movement
 
   if ( cursor.home.cap )
   {
-    const int new_time = relativeMove (temp_result, 0, 0, xnew, ynew);
+    const int new_time = relativeMoveDuration (0, 0, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.home.duration + new_time < move_time )
@@ -993,13 +970,13 @@ inline auto FOptiMove::isMethod3Faster ( int& move_time
 
 //----------------------------------------------------------------------
 inline auto FOptiMove::isMethod4Faster ( int& move_time
-                                       , int xnew, int ynew ) -> bool
+                                       , int xnew, int ynew ) const -> bool
 {
   // Test method 4: home-down + local movement
   if ( cursor.to_ll.cap )
   {
     int down = int(screen.height) - 1;
-    const int new_time = relativeMove (temp_result, 0, down, xnew, ynew);
+    const int new_time = relativeMoveDuration (0, down, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.to_ll.duration + new_time < move_time )
@@ -1015,7 +992,7 @@ inline auto FOptiMove::isMethod4Faster ( int& move_time
 //----------------------------------------------------------------------
 inline auto FOptiMove::isMethod5Faster ( int& move_time
                                        , int yold
-                                       , int xnew, int ynew ) -> bool
+                                       , int xnew, int ynew ) const -> bool
 {
   // Test method 5: left margin for wrap to right-hand side
   if ( automatic_left_margin
@@ -1025,7 +1002,7 @@ inline auto FOptiMove::isMethod5Faster ( int& move_time
   {
     int x = int(screen.width) - 1;
     int y = yold - 1;
-    const int new_time = relativeMove (temp_result, x, y, xnew, ynew);
+    const int new_time = relativeMoveDuration (x, y, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.carriage_return.cap
@@ -1048,10 +1025,11 @@ void FOptiMove::moveByMethod ( int method
 {
   switch ( method )
   {
-    case 0:  // direct cursor addressing
-      return;
+    case 0:  // direct cursor addressing (already in move_buf)
+      break;
 
     case 1:
+      move_buf.clear();
       relativeMove (move_buf, xold, yold, xnew, ynew);
       break;
 
@@ -1077,22 +1055,24 @@ void FOptiMove::moveByMethod ( int method
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithCarriageReturn (int yold, int xnew, int ynew)
+inline auto FOptiMove::moveWithAddress (int xnew, int ynew) -> bool
 {
-  if ( ! cursor.carriage_return.cap )
-    return;
+  move_buf = FTermcap::encodeMotionParameter(parm_cursor.address.cap, xnew, ynew);
+  return ! move_buf.empty();
+}
 
+//----------------------------------------------------------------------
+inline void FOptiMove::moveWithCarriageReturn (int yold, int xnew, int ynew)
+{
   move_buf = cursor.carriage_return.cap;
-  relativeMove (temp_result, 0, yold, xnew, ynew);
-  move_buf.append(temp_result);
+  relativeMove (move_buf, 0, yold, xnew, ynew);
 }
 
 //----------------------------------------------------------------------
 inline void FOptiMove::moveWithHome (int xnew, int ynew)
 {
   move_buf = cursor.home.cap;
-  relativeMove (temp_result, 0, 0, xnew, ynew);
-  move_buf.append(temp_result);
+  relativeMove (move_buf, 0, 0, xnew, ynew);
 }
 
 //----------------------------------------------------------------------
@@ -1100,8 +1080,7 @@ inline void FOptiMove::moveWithToLL (int xnew, int ynew)
 {
   move_buf = cursor.to_ll.cap;
   int down = int(screen.height) - 1;
-  relativeMove (temp_result, 0, down, xnew, ynew);
-  move_buf.append(temp_result);
+  relativeMove (move_buf, 0, down, xnew, ynew);
 }
 
 //----------------------------------------------------------------------
@@ -1116,8 +1095,7 @@ inline void FOptiMove::moveWithCRAndWrapToLeft ( int xold, int yold
   move_buf.append(cursor.left.cap);
   int x = int(screen.width) - 1;
   int y = yold - 1;
-  relativeMove (temp_result, x, y, xnew, ynew);
-  move_buf.append(temp_result);
+  relativeMove (move_buf, x, y, xnew, ynew);
 }
 
 
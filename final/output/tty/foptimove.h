@@ -38,6 +38,7 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <array>
 #include <cassert>
 #include <cctype>
 #include <climits>
@@ -159,7 +160,7 @@ class FOptiMove final
 
     // Methods
     void  check_boundaries (int&, int&, int&, int&) const;
-    auto  moveCursor (int, int, int, int) -> std::string;
+    auto  moveCursor (int, int, int, int) -> const std::string&;
 
   private:
     struct Capability
@@ -216,49 +217,82 @@ class FOptiMove final
     // value for a long capability waiting time
     static constexpr int MOVE_LIMIT{7};
     // maximum character distance to avoid direct cursor addressing
+    static constexpr std::size_t PARM_TABLE_SIZE{64u};
+    // number of precalculated parameterized cursor movements
+
+    // Enumeration
+    enum class MotionType
+    {
+      None,            // No movement or no usable capability
+      Address,         // Column or row addressing
+      Parameterized,   // Parameterized cursor movement
+      Repeated         // Repeated (back) tabs and single steps
+    };
+
+    struct Motion
+    {
+      MotionType type{MotionType::None};
+      int        duration{LONG_DURATION};
+      int        count{0};  // Number of cells or single steps
+      int        tabs{0};   // Number of (back) tabs
+    };
+
+    // Using-declaration
+    using SequenceTable = std::array<std::string, PARM_TABLE_SIZE>;
+
+    struct ParmSequences
+    {
+      SequenceTable  up{};
+      SequenceTable  down{};
+      SequenceTable  left{};
+      SequenceTable  right{};
+    };
 
     // Methods
     void  calculateCharDuration();
     auto  capDuration (const char[], int) const -> int;
     auto  capDurationToLength (int) const -> int;
-    auto  repeatedAppend (std::string&, const Capability&, int) const -> int;
-    auto  relativeMove (std::string&, int, int, int, int) const -> int;
-    auto  verticalMove (std::string&, int, int) const -> int;
-    void  downMove (std::string&, int&, int, int) const;
-    void  upMove (std::string&, int&, int, int) const;
-    auto  horizontalMove (std::string&, int, int) const -> int;
-    void  moveWithParmRightCursor (std::string&, int&, int) const;
-    void  moveWithRightCursor (std::string&, int&, int, int, int) const;
-    void  rightMove (std::string&, int&, int, int) const;
-    void  moveWithParmLeftCursor (std::string&, int&, int) const;
-    void  moveWithLeftCursor (std::string&, int&, int, int, int) const;
-    void  leftMove (std::string&, int&, int, int) const;
+    static void calculateParmSequences (SequenceTable&, const char[]);
+    static auto repeatedDuration (const Capability&, int, std::size_t) -> int;
+    static void repeatedAppend (std::string&, const Capability&, int);
+    static void parameterizedAppend ( std::string&, const Capability&
+                                    , const SequenceTable&, int );
+    auto  relativeMoveDuration (int, int, int, int) const -> int;
+    void  relativeMove (std::string&, int, int, int, int) const;
+    auto  verticalMotion (int, int) const -> Motion;
+    auto  horizontalMotion (int, int) const -> Motion;
+    auto  steppedMotion (int, int) const -> Motion;
+    auto  nextTabPosition (int, bool) const -> int;
+    void  verticalMove (std::string&, const Motion&, int, int) const;
+    void  horizontalMove (std::string&, const Motion&, int, int) const;
 
     auto  isWideMove (int, int, int, int) const -> bool;
-    auto  isMethod0Faster (int&, int, int) -> bool;
-    auto  isMethod1Faster (int&, int, int, int, int) -> bool;
-    auto  isMethod2Faster (int&, int, int, int) -> bool;
-    auto  isMethod3Faster (int&, int, int) -> bool;
-    auto  isMethod4Faster (int&, int, int) -> bool;
-    auto  isMethod5Faster (int&, int, int, int) -> bool;
+    auto  getFastestMethod (int&, int, int, int, int, bool) const -> int;
+    auto  isMethod0Faster (int&) const -> bool;
+    auto  isMethod1Faster (int&, int, int, int, int) const -> bool;
+    auto  isMethod2Faster (int&, int, int, int) const -> bool;
+    auto  isMethod3Faster (int&, int, int) const -> bool;
+    auto  isMethod4Faster (int&, int, int) const -> bool;
+    auto  isMethod5Faster (int&, int, int, int) const -> bool;
     void  moveByMethod (int, int, int, int, int);
+    auto  moveWithAddress (int, int) -> bool;
     void  moveWithCarriageReturn (int, int, int);
     void  moveWithHome (int, int);
     void  moveWithToLL (int, int);
     void  moveWithCRAndWrapToLeft (int, int, int, int);
 
     // Data members
-    Cursor      cursor{};
-    ParamCursor parm_cursor{};
-    Edit        edit{};
-    Dimension   screen{80, 24};
-    int         char_duration{1};
-    int         baudrate{9600};
-    int         tabstop{0};
-    std::string move_buf{};
-    std::string temp_result{};
-    bool        automatic_left_margin{false};
-    bool        eat_nl_glitch{false};
+    Cursor        cursor{};
+    ParamCursor   parm_cursor{};
+    Edit          edit{};
+    ParmSequences parm_sequences{};
+    Dimension     screen{80, 24};
+    int           char_duration{1};
+    int           baudrate{9600};
+    int           tabstop{0};
+    std::string   move_buf{};
+    bool          automatic_left_margin{false};
+    bool          eat_nl_glitch{false};
 
     // Friend function
     friend void printDurations (const FOptiMove&);
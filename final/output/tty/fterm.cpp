@@ -1256,6 +1256,32 @@ void FTerm::init_optiAttr()
   };
 
   static auto& opti_attr = FOptiAttr::getInstance();
+  static const auto& data = FTermData::getInstance();
+
+  // ECMA-48 conformant terminals get their SGR sequences directly
+  if ( data.isTermType ( FTermType::xterm
+                       | FTermType::urxvt
+                       | FTermType::kde_konsole
+                       | FTermType::gnome_terminal
+                       | FTermType::putty
+                       | FTermType::win_terminal
+                       | FTermType::mintty
+                       | FTermType::stterm
+                       | FTermType::tmux
+                       | FTermType::kitty )
+    && ! data.isTermType ( FTermType::screen
+                         | FTermType::tera_term
+                         | FTermType::linux_con ) )
+    opti_attr.setDirectSGRSupport();
+  else
+    opti_attr.unsetDirectSGRSupport();
+
+  // RGB colors are quantized to the palette without 24-bit color support
+  if ( FTermDetection::getInstance().canDisplayTrueColors() )
+    opti_attr.setTrueColorSupport();
+  else
+    opti_attr.unsetTrueColorSupport();
+
   opti_attr.setTermEnvironment(optiattr_env);
 }
 
@@ -2020,6 +2046,9 @@ void FTerm::finish() const
   // Restore the saved termios settings
   FTermios::restoreTTYsettings();
 
+  // Switch stdin back to blocking mode
+  FKeyboard::getInstance().unsetNonBlockingInput();
+
   // Reset all terminal attributes
   clearTerminalAttributes();
 
@@ -646,6 +646,10 @@ FTermcap::TCapMapType FTermcap::strings =
   { nullptr, {"Ss"} },  // set cursor style       -> Select the DECSCUSR cursor style
   { nullptr, {"sf"} },  // scroll_forward         -> scroll text up (P)
   { nullptr, {"sr"} },  // scroll_reverse         -> scroll text down (P)
+  { nullptr, {"cs"} },  // change_scroll_region   -> change region to line #1 to line #2 (P)
+  { nullptr, {"Lh"} },  // enter_lr_margin_mode   -> enable left and right margins (DECLRMM)
+  { nullptr, {"Lm"} },  // set_lr_margins         -> set left margin #1, right margin #2
+  { nullptr, {"Ll"} },  // exit_lr_margin_mode    -> disable left and right margins
   { nullptr, {"ti"} },  // enter_ca_mode          -> string to start programs using cup
   { nullptr, {"te"} },  // exit_ca_mode           -> strings to end programs using cup
   { nullptr, {"eA"} },  // enable_acs             -> enable alternate char set
@@ -695,7 +699,8 @@ FTermcap::TCapMapType FTermcap::strings =
  *        to the number of lines affected
  * (#i)   indicates the ith parameter.
  *
- * "XX", "Us" and "Ue" are unofficial and they are only used here.
+ * "Lh", "Lm", "Ll", "XX", "Us" and "Ue" are unofficial
+ * and they are only used here.
  */
 
 }  // namespace finalcut
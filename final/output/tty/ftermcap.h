@@ -76,7 +76,7 @@ class FTermcap final
     };
 
     // Using-declaration
-    using TCapMapType = std::array<TCapMap, 86>;
+    using TCapMapType = std::array<TCapMap, 90>;
     using PutCharFunc = std::decay_t<int(int)>;
     using PutStringFunc = std::decay_t<int(const std::string&)>;
 
@@ -31,6 +31,7 @@
 #include "final/output/tty/ftermcap.h"
 #include "final/output/tty/ftermcapquirks.h"
 #include "final/output/tty/ftermdata.h"
+#include "final/output/tty/ftermdetection.h"
 #include "final/output/tty/fterm.h"
 
 namespace finalcut
@@ -131,6 +132,8 @@ void FTermcapQuirks::terminalFixup()
   general();
   // Repeat utf-8 character
   repeatLastChar();
+  // Scroll regions with left and right margins
+  lrMargins();
   // ECMA-48 (ANSI X3.64) compatible terminal
   ecma48();
 }
@@ -496,6 +499,20 @@ void FTermcapQuirks::repeatLastChar()
   setTCapString (TCAP(t_repeat_last_char), "\033[%p1%{1}%-%db");
 }
 
+//----------------------------------------------------------------------
+void FTermcapQuirks::lrMargins()
+{
+  // The terminal reports the left and right margin mode (DECLRMM)
+  // via the DEC private mode request
+
+  if ( ! FTermDetection::getInstance().hasLeftRightMarginSupport() )
+    return;
+
+  setTCapStringIfNotSet (TCAP(t_enter_lr_margin_mode), CSI "?69h");
+  setTCapStringIfNotSet (TCAP(t_set_lr_margins), CSI "%i%p1%d;%p2%ds");  // DECSLRM
+  setTCapStringIfNotSet (TCAP(t_exit_lr_margin_mode), CSI "?69l");
+}
+
 //----------------------------------------------------------------------
 void FTermcapQuirks::ecma48()
 {
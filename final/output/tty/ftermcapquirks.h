@@ -77,6 +77,7 @@ class FTermcapQuirks final
     static void general();
     static void caModeExtension();
     static void repeatLastChar();
+    static void lrMargins();
     static void ecma48();
 };
 
@@ -346,6 +346,9 @@ void FTermDetection::detectTerminal()
     // Determines the maximum number of colors
     new_termtype = determineMaxColor(new_termtype);
 
+    // Check for synchronized output and left/right margin support
+    detectPrivateModeSupport();
+
     keyboard.unsetNonBlockingInput();
     FTermios::unsetCaptureSendCharacters();
   }
@@ -388,6 +391,11 @@ auto FTermDetection::init_256colorTerminal() -> FString
 {
   color256 = \
       bool( get256colorEnvString() || termtype.includes("256color") );
+  // COLORTERM announces direct 24-bit RGB colors
+  truecolor = color_env.string1 == "truecolor"
+           || color_env.string1 == "24bit"
+           || ! color_env.string8.isEmpty()  // kitty
+           || termtype.includes("direct");
   FString new_termtype = termtype_256color_quirks();
 
 #if DEBUG
@@ -982,4 +990,68 @@ inline void FTermDetection::correctFalseAssumptions (int terminal_id_type) const
     fterm_data.unsetTermType (FTermType::kde_konsole);
 }
 
+//----------------------------------------------------------------------
+void FTermDetection::detectPrivateModeSupport()
+{
+  // The Linux console and the cygwin terminal do not know
+  // the DEC private mode request (DECRQM)
+
+  const auto& fterm_data = FTermData::getInstance();
+
+  if ( fterm_data.isTermType(FTermType::linux_con | FTermType::cygwin) )
+    return;
+
+  const auto& mode_reports = getPrivateModeReports();
+
+  // Synchronized output (mode 2026)
+  sync_update_support = isPrivateModeSupported(mode_reports, 2026);
+
+  // Left and right margin mode (DECLRMM, mode 69)
+  lr_margin_support = isPrivateModeSupported(mode_reports, 69);
+}
+
+//----------------------------------------------------------------------
+auto FTermDetection::getPrivateModeReports() const -> std::string
+{
+  const auto& stdout_no{FTermios::getStdOut()};
+
+  // Request the private modes (DECRQM) followed by a device
+  // attribute request (DA) that every terminal answers.
+  // So there is no need to wait for the timeout if the terminal
+  // ignores the mode requests.
+  const std::string DECRQM{ESC "[?2026$p" ESC "[?69$p" ESC "[c"};
+
+  if ( write(stdout_no, DECRQM.data(), DECRQM.length()) == -1 )
+    return {};
+
+  std::fflush(stdout);
+  std::array<char, 80> temp{};
+  auto isWithout_c = [] (const auto& t) { return ! std::strchr(t.data(), 'c'); };
+  captureTerminalInput(temp, 150'000, isWithout_c);
+  return temp.data();
+}
+
+//----------------------------------------------------------------------
+auto FTermDetection::isPrivateModeSupported ( const std::string& mode_reports
+                                            , int mode ) const -> bool
+{
+  // Report mode values (DECRPM): 1 = set, 2 = reset (both supported),
+  //                              0 = not recognized, 4 = permanently reset
+
+  const auto& report = "\033[?" + std::to_string(mode) + ';';
+  const auto pos = mode_reports.find(report);
+
+  if ( pos == std::string::npos )
+    return false;
+
+  const auto value_pos = pos + report.length();
+
+  if ( value_pos + 3 > mode_reports.length()
+    || mode_reports.compare(value_pos + 1, 2, "$y") != 0 )
+    return false;
+
+  const auto value = mode_reports[value_pos];
+  return value == '1' || value == '2';
+}
+
 }  // namespace finalcut
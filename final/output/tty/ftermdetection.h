@@ -71,8 +71,11 @@ class FTermDetection final
 
     // Inquiries
     auto  canDisplay256Colors() const noexcept -> bool;
+    auto  canDisplayTrueColors() const noexcept -> bool;
     auto  hasTerminalDetection() const noexcept -> bool;
     auto  hasSetCursorStyleSupport() const noexcept -> bool;
+    auto  hasSynchronizedUpdateSupport() const noexcept -> bool;
+    auto  hasLeftRightMarginSupport() const noexcept -> bool;
 
     // Mutators
     void  setTerminalDetection (bool = true) noexcept;
@@ -143,6 +146,9 @@ class FTermDetection final
     auto  secDA_Analysis_vte (const FString&) -> FString;
     auto  secDA_Analysis_kitty (const FString&) -> FString;
     void  correctFalseAssumptions (int) const;
+    void  detectPrivateModeSupport();
+    auto  getPrivateModeReports() const -> std::string;
+    auto  isPrivateModeSupported (const std::string&, int) const -> bool;
 
     // Data members
 #if DEBUG
@@ -153,8 +159,11 @@ class FTermDetection final
     FString      termtype{};
     FString      ttytypename{"/etc/ttytype"};  // Default ttytype file
     bool         decscusr_support{false};      // Preset to false
+    bool         sync_update_support{false};   // Preset to false
+    bool         lr_margin_support{false};     // Preset to false
     bool         terminal_detection{true};     // Preset to true
     bool         color256{};
+    bool         truecolor{};
     FString      answer_back{};
     FString      sec_da{};
     colorEnv     color_env{};
@@ -189,10 +198,22 @@ inline auto FTermDetection::getTermType_SecDA() const & -> const FString&
 inline auto FTermDetection::canDisplay256Colors() const noexcept -> bool
 { return color256; }
 
+//----------------------------------------------------------------------
+inline auto FTermDetection::canDisplayTrueColors() const noexcept -> bool
+{ return truecolor; }
+
 //----------------------------------------------------------------------
 inline auto FTermDetection::hasSetCursorStyleSupport() const noexcept -> bool
 { return decscusr_support; }
 
+//----------------------------------------------------------------------
+inline auto FTermDetection::hasSynchronizedUpdateSupport() const noexcept -> bool
+{ return sync_update_support; }
+
+//----------------------------------------------------------------------
+inline auto FTermDetection::hasLeftRightMarginSupport() const noexcept -> bool
+{ return lr_margin_support; }
+
 //----------------------------------------------------------------------
 inline auto FTermDetection::hasTerminalDetection() const noexcept -> bool
 { return terminal_detection; }
@@ -20,8 +20,18 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
-#include <algorithm>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #include <immintrin.h>
+  #define AVX2_DISPATCH_SUPPORT
+#endif
+
+#include <sys/select.h>
 #include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <string>
 #include <unordered_map>
 
 #include "final/fobject.h"
@@ -32,13 +42,15 @@
 #include "final/output/tty/foptimove.h"
 #include "final/output/tty/ftermcap.h"
 #include "final/output/tty/ftermdata.h"
+#include "final/output/tty/ftermdetection.h"
 #include "final/output/tty/ftermfreebsd.h"
 #include "final/output/tty/ftermios.h"
 #include "final/output/tty/ftermoutput.h"
 #include "final/output/tty/ftermxterminal.h"
-#include "final/util/char_ringbuffer.h"
 #include "final/util/fpoint.h"
+#include "final/util/frect.h"
 #include "final/util/fsize.h"
+#include "final/util/fsystem.h"
 
 namespace finalcut
 {
@@ -53,6 +65,136 @@ struct var
 
 Encoding var::terminal_encoding{Encoding::Unknown};
 
+//----------------------------------------------------------------------
+inline auto getNoChangesBit() noexcept -> uInt32
+{
+  static const auto bit = []
+  {
+    FAttribute attr{};
+    attr.bit.no_changes = true;
+    return attr.word;
+  }();
+
+  return bit;
+}
+
+//----------------------------------------------------------------------
+inline auto getUTF8Length (wchar_t wide_char) noexcept -> uInt
+{
+  const auto ucs = uInt32(wide_char);
+
+  if ( ucs < 0x80 )
+    return 1;
+
+  if ( ucs < 0x800 )
+    return 2;
+
+  if ( ucs < 0x10000 )
+    return 3;
+
+  return 4;
+}
+
+//----------------------------------------------------------------------
+inline auto countTrailingZeros (uInt64 value) noexcept -> uInt
+{
+  // value must not be zero
+#if HAVE_BUILTIN(__builtin_ctzll) || defined(__GNUC__)
+  return uInt(__builtin_ctzll(value));
+#else
+  uInt count{0};
+
+  while ( (value & 1) == 0 )
+  {
+    value >>= 1;
+    count++;
+  }
+
+  return count;
+#endif
+}
+
+//----------------------------------------------------------------------
+inline auto getNoChangesMaskScalar ( const FChar* fchar, uInt i
+                                   , uInt n, uInt64 mask ) noexcept -> uInt64
+{
+  // Sets bit i for each of the characters fchar[i .. n-1]
+  // that has the no_changes attribute
+
+  const auto no_changes_bit = getNoChangesBit();
+
+  for (; i < n; i++)
+  {
+    if ( fchar[i].attr.word & no_changes_bit )
+      mask |= uInt64(1) << i;
+  }
+
+  return mask;
+}
+
+#if defined(AVX2_DISPATCH_SUPPORT)
+//----------------------------------------------------------------------
+__attribute__((target("avx2")))
+auto getNoChangesMaskAVX2 (const FChar* fchar, uInt n) noexcept -> uInt64
+{
+  // The attribute words of eight characters are gathered at once
+
+  static_assert ( sizeof(FChar) % sizeof(int) == 0
+                , "FChar size must be a multiple of the int size" );
+  constexpr int stride = int(sizeof(FChar) / sizeof(int));
+  const auto index = _mm256_setr_epi32 ( 0, stride, 2 * stride, 3 * stride
+                                       , 4 * stride, 5 * stride
+                                       , 6 * stride, 7 * stride );
+  const auto bit = _mm256_set1_epi32(int(getNoChangesBit()));
+  const auto* attr_base = reinterpret_cast<const int*>
+  (
+    reinterpret_cast<const char*>(fchar) + offsetof(FChar, attr)
+  );
+  uInt64 mask{0};
+  uInt i{0};
+
+  for (; i + 8 <= n; i += 8)
+  {
+    const auto attr = _mm256_i32gather_epi32 (attr_base + i * stride, index, 4);
+    const auto set = _mm256_cmpeq_epi32(_mm256_and_si256(attr, bit), bit);
+    const auto bits = _mm256_movemask_ps(_mm256_castsi256_ps(set));
+    mask |= uInt64(uInt(bits)) << i;
+  }
+
+  // Handle the remaining elements
+  return getNoChangesMaskScalar (fchar, i, n, mask);
+}
+
+//----------------------------------------------------------------------
+inline auto hasAVX2() noexcept -> bool
+{
+  // The AVX2 variant is selected at runtime,
+  // so that the default build can use it as well
+
+  static const bool avx2 = []
+  {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+
+  return avx2;
+}
+#endif  // defined(AVX2_DISPATCH_SUPPORT)
+
+//----------------------------------------------------------------------
+inline auto getNoChangesMask (const FChar* fchar, uInt n) noexcept -> uInt64
+{
+  // Returns a bit mask of up to 64 characters in which
+  // bit i is set if fchar[i] has the no_changes attribute
+
+#if defined(AVX2_DISPATCH_SUPPORT)
+  if ( hasAVX2() )
+    return getNoChangesMaskAVX2 (fchar, n);
+#endif
+
+  return getNoChangesMaskScalar (fchar, 0, n, 0);
+}
+
 }  // namespace internal
 
 // static class attributes
@@ -116,6 +258,12 @@ auto FTermOutput::getKeyName (FKey keynum) const -> FString
   return FTerm::getKeyName(keynum);
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::getTargetFrameRate() const -> uInt
+{
+  return target_frame_rate;
+}
+
 //----------------------------------------------------------------------
 auto FTermOutput::isMonochron() const -> bool
 {
@@ -264,6 +412,20 @@ void FTermOutput::setNonBlockingRead (bool enable)
   FKeyboard::setReadBlockingTime (blocking_time);
 }
 
+//----------------------------------------------------------------------
+void FTermOutput::setTargetFrameRate (uInt fps)
+{
+  // Limits the terminal updates to fps frames per second.
+  // 0 restores the default limit of 60 frames per second.
+
+  target_frame_rate = fps;
+  min_flush_wait = ( fps == 0 ) ? MIN_FLUSH_WAIT : 1'000'000 / uInt64(fps);
+  max_flush_wait = std::max(min_flush_wait, MAX_FLUSH_WAIT);
+  flush_wait = min_flush_wait;
+  flush_average = min_flush_wait;
+  flush_median = min_flush_wait;
+}
+
 //----------------------------------------------------------------------
 void FTermOutput::initTerminal (FVTerm::FTermArea* virtual_terminal)
 {
@@ -274,13 +436,18 @@ void FTermOutput::initTerminal (FVTerm::FTermArea* virtual_terminal)
   redefineColorPalette();
 
   vterm         = virtual_terminal;
-  output_buffer = std::make_shared<OutputBuffer>();
+  output_buffer.reserve(BUFFER_SIZE);
   term_pos      = std::make_shared<FPoint>(-1, -1);
 
   // Hide the input cursor
   cursor_hideable = FTerm::isCursorHideable();
   hideCursor();
 
+  // Bracket each screen update with synchronized output sequences
+  static const auto& term_detection = FTermDetection::getInstance();
+  sync_update_support = getStartOptions().synchronized_update
+                     && term_detection.hasSynchronizedUpdateSupport();
+
   // Defining the character length of termcap strings
   init_characterLengths();
 
@@ -292,6 +459,10 @@ void FTermOutput::initTerminal (FVTerm::FTermArea* virtual_terminal)
 
   // Initialize the last flush time
   time_last_flush = TimeValue{};
+
+  // Frame rate limit from the command line (--frame-rate)
+  if ( getStartOptions().frame_rate > 0 )
+    setTargetFrameRate (getStartOptions().frame_rate);
 }
 
 //----------------------------------------------------------------------
@@ -314,6 +485,7 @@ auto FTermOutput::updateTerminal() -> bool
   // Updates pending changes to the terminal
 
   int changedlines{0};
+  beginSynchronizedUpdate();
 
   for (uInt y{0}; y < uInt(vterm->size.height); y++)
   {
@@ -327,6 +499,9 @@ auto FTermOutput::updateTerminal() -> bool
 
   // sets the new input cursor position
   const auto& cursor_update = updateTerminalCursor();
+  // Close the update only at the end of the frame, because the
+  // output buffer can already be flushed during the frame
+  endSynchronizedUpdate();
   return cursor_update || changedlines > 0;
 }
 
@@ -368,6 +543,42 @@ auto FTermOutput::scrollTerminalReverse() -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::scrollTerminalRegionForward (const FRect& region) -> bool
+{
+  // Scrolls the terminal region (0-based coordinates) up one line
+
+  if ( ! TCAP(t_scroll_forward) || ! canScrollTerminalRegion(region) )
+    return false;
+
+  // The scrolling is part of the next frame and is
+  // rendered together with the newly exposed line
+  beginSynchronizedUpdate();
+  setScrollRegion (region);
+  setCursor (FPoint{region.getX1(), region.getY2()});
+  appendOutputBuffer (FTermControl{TCAP(t_scroll_forward)});
+  resetScrollRegion (region);
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FTermOutput::scrollTerminalRegionReverse (const FRect& region) -> bool
+{
+  // Scrolls the terminal region (0-based coordinates) down one line
+
+  if ( ! TCAP(t_scroll_reverse) || ! canScrollTerminalRegion(region) )
+    return false;
+
+  // The scrolling is part of the next frame and is
+  // rendered together with the newly exposed line
+  beginSynchronizedUpdate();
+  setScrollRegion (region);
+  setCursor (FPoint{region.getX1(), region.getY1()});
+  appendOutputBuffer (FTermControl{TCAP(t_scroll_reverse)});
+  resetScrollRegion (region);
+  return true;
+}
+
 //----------------------------------------------------------------------
 void FTermOutput::clearTerminalAttributes()
 {
@@ -442,28 +653,37 @@ void FTermOutput::flush()
 
   flushTimeAdjustment();
 
-  if ( ! output_buffer || output_buffer->isEmpty()
+  if ( output_buffer.empty()
     || ! (isFlushTimeout() || getFVTerm().isTerminalUpdateForced()) )
     return;
 
-  while ( ! output_buffer->isEmpty() )
-  {
-    const auto& first = output_buffer->front();
-    const auto& type = first.type;
-    const auto& data = first.data;
-
-    if ( type == OutputType::String )
-      FTerm::stringPrint (data);
-    else if ( type == OutputType::Control )
-      FTerm::paddingPrint (data);
+  const auto write_start = FObjectTimer::getCurrentTime();
+  // Previously buffered stdio output must reach the terminal first
+  std::fflush(stdout);
+  std::size_t pos{0};
 
-    output_buffer->pop();
+  for (const auto& segment : padding_segments)
+  {
+    // Control strings with delay padding are output via termcap
+    writeOutputBuffer (output_buffer.data() + pos, segment.offset - pos);
+    padding_string.assign (output_buffer, segment.offset, segment.length);
+    FTerm::paddingPrint (padding_string);
+    std::fflush(stdout);
+    pos = segment.offset + segment.length;
   }
 
-  std::fflush(stdout);
+  writeOutputBuffer (output_buffer.data() + pos, output_buffer.size() - pos);
+  output_buffer.clear();  // Keeps the capacity for the next frame
+  padding_segments.clear();
   static auto& mouse = FMouseControl::getInstance();
   mouse.drawPointer();
   time_last_flush = FObjectTimer::getCurrentTime();
+
+  // A slow terminal connection blocks the write. The time required
+  // limits the frame rate, so that no backlog of frames builds up.
+  const auto write_duration = time_last_flush - write_start;
+  const auto usec = uInt64(duration_cast<microseconds>(write_duration).count());
+  write_time = (3 * write_time + usec) / 4;
 }
 
 //----------------------------------------------------------------------
@@ -557,25 +777,43 @@ void FTermOutput::init_characterLengths()
 {
   const auto& opti_move = FOptiMove::getInstance();
   cursor_address_length = opti_move.getCursorAddressLength();
-  erase_char_length     = opti_move.getEraseCharsLength();
-  repeat_char_length    = opti_move.getRepeatCharLength();
   clr_bol_length        = opti_move.getClrBolLength();
   clr_eol_length        = opti_move.getClrEolLength();
 
   if ( cursor_address_length == 0 )
     cursor_address_length = INT_MAX;
 
-  if ( erase_char_length == 0 )
-    erase_char_length = INT_MAX;
-
-  if ( repeat_char_length == 0 )
-    repeat_char_length = INT_MAX;
-
   if ( clr_bol_length == 0 )
     clr_bol_length = INT_MAX;
 
   if ( clr_eol_length == 0 )
     clr_eol_length = INT_MAX;
+
+  init_parameterLengths();
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::init_parameterLengths()
+{
+  // Stores the lengths of the parameterized repeat and erase sequences
+  // for each number of decimal digits. The largest number with these
+  // digits gives an upper bound, so that no run has to be encoded twice.
+
+  const auto& rp = TCAP(t_repeat_char);
+  const auto& lr = TCAP(t_repeat_last_char);
+  const auto& ec = TCAP(t_erase_chars);
+  uInt num{0};
+
+  for (std::size_t digits{1}; digits <= MAX_PARAMETER_DIGITS; digits++)
+  {
+    num = num * 10 + 9;
+    repeat_char_lengths[digits] = rp
+        ? uInt(FTermcap::encodeParameter(rp, ' ', num).length()) : 0;
+    repeat_last_char_lengths[digits] = lr
+        ? uInt(FTermcap::encodeParameter(lr, num).length()) : 0;
+    erase_chars_lengths[digits] = ec
+        ? uInt(FTermcap::encodeParameter(ec, num).length()) : 0;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -612,8 +850,6 @@ auto FTermOutput::canClearToEOL (uInt xmin, uInt y) const -> bool
     return false;
 
   uInt beginning_whitespace = 1;
-  const auto& normal = FOptiAttr::isNormal(*min_char);
-  const auto& ut = FTermcap::background_color_erase;
   const auto* ch = min_char + 1;
 
   for (int x{int(xmin) + 1}; x < vterm->size.width; x++)
@@ -627,7 +863,7 @@ auto FTermOutput::canClearToEOL (uInt xmin, uInt y) const -> bool
   }
 
   return ( beginning_whitespace == uInt(vterm->size.width) - xmin
-        && (ut || normal)
+        && isErasable(*min_char)
         && clr_eol_length < beginning_whitespace );
 }
 
@@ -681,8 +917,6 @@ auto FTermOutput::canClearTrailingWS (uInt& xmax, uInt y) const -> bool
     return false;
 
   uInt trailing_whitespace = 1;
-  const auto& normal = FOptiAttr::isNormal(*last_char);
-  const auto& ut = FTermcap::background_color_erase;
   const auto* ch = last_char;
 
   for (int x{vterm->size.width - 1}; x > 0 ; x--)
@@ -695,8 +929,9 @@ auto FTermOutput::canClearTrailingWS (uInt& xmax, uInt y) const -> bool
     --ch;
   }
 
-  if ( trailing_whitespace > uInt(vterm->size.width) - xmax && (ut || normal)
-    && clr_bol_length < trailing_whitespace )
+  if ( trailing_whitespace > uInt(vterm->size.width) - xmax
+    && isErasable(*last_char)
+    && clr_eol_length < trailing_whitespace )
   {
     xmax = uInt(vterm->size.width) - trailing_whitespace;
     return true;
@@ -706,64 +941,109 @@ auto FTermOutput::canClearTrailingWS (uInt& xmax, uInt y) const -> bool
 }
 
 //----------------------------------------------------------------------
-auto FTermOutput::skipUnchangedCharacters (uInt& x, uInt xmax, uInt y) -> bool
+void FTermOutput::findUnchangedSpans (uInt xmin, uInt xmax, uInt y)
 {
-  // Skip characters without changes if it is faster than redrawing
+  // Collects all runs of characters without changes in the range
+  // [xmin .. xmax] in a single pass over blocks of 64 characters
 
-  auto* print_char = &vterm->getFChar(int(x), int(y));
-  print_char->attr.bit.printed = true;
+  unchanged_spans.clear();
+  const auto* first_char = &vterm->getFChar(int(xmin), int(y));
+  const uInt length = xmax - xmin + 1;
+  bool in_span{false};
+  uInt span_start{0};
 
-  if ( ! print_char->attr.bit.no_changes )
-    return false;
-
-  uInt count{1};
-  const auto* ch = print_char + 1;
-  const auto* end = print_char + xmax - x + 1;
-
-  // Unroll the loop for better performance
-  while ( ch + 4 <= end )
+  for (uInt block{0}; block < length; block += 64)
   {
-    if ( ch[0].attr.bit.no_changes && ch[1].attr.bit.no_changes
-      && ch[2].attr.bit.no_changes && ch[3].attr.bit.no_changes )
+    const uInt n = std::min(length - block, uInt(64));
+    const uInt64 valid = ( n == 64 ) ? ~uInt64(0) : (uInt64(1) << n) - 1;
+    const uInt64 mask = internal::getNoChangesMask(first_char + block, n);
+    uInt pos{0};
+
+    while ( pos < n )
     {
-      count += 4;
-    }
-    else
-      break;
+      // Search for the next span border
+      const uInt64 bits = ( in_span ? ~mask & valid : mask ) >> pos;
 
-    ch += 4;
-  }
+      if ( bits == 0 )
+        break;
 
-  // Handle the remaining elements
-  while ( ch < end )
-  {
-    if ( ch->attr.bit.no_changes )
-      count++;
-    else
-      break;
+      pos += internal::countTrailingZeros(bits);
 
-    ++ch;
+      if ( in_span )
+        unchanged_spans.push_back({xmin + span_start, xmin + block + pos - 1});
+      else
+        span_start = block + pos;
+
+      in_span = ! in_span;
+    }
   }
 
+  if ( in_span )
+    unchanged_spans.push_back({xmin + span_start, xmax});
+}
+
+//----------------------------------------------------------------------
+auto FTermOutput::skipUnchangedCharacters ( uInt& x, uInt y
+                                          , SpanList::const_iterator& span ) -> bool
+{
+  // Skip characters without changes if it is faster than redrawing
+
+  const auto end = unchanged_spans.cend();
+
+  while ( span != end && span->end < x )
+    ++span;
+
+  if ( span == end || x < span->start )
+    return false;
+
+  const uInt count = span->end - x + 1;
+
   if ( count > cursor_address_length )
   {
     setCursor (FPoint{int(x + count), int(y)});
-    x = x + count - 1;
+    x = span->end;
     return true;
   }
 
   return false;
 }
 
+//----------------------------------------------------------------------
+void FTermOutput::printSpans ( const FVTerm::FLineChanges& line_changes
+                             , uInt xmin, uInt xmax, uInt y )
+{
+  // Prints the changed spans of line y within the range [xmin .. xmax].
+  // The columns between the spans are skipped with a cursor movement.
+
+  const auto span_count = line_changes.getSpanCount();
+
+  for (std::size_t i{0}; i < span_count; i++)
+  {
+    const auto span = line_changes.getSpan(i);
+    const auto x1 = std::max(span.xmin, xmin);
+    const auto x2 = std::min(span.xmax, xmax);
+
+    if ( x1 > x2 )
+      continue;
+
+    setCursor (FPoint{int(x1), int(y)});
+    printRange (x1, x2, y);
+  }
+}
+
 //----------------------------------------------------------------------
 void FTermOutput::printRange (uInt xmin, uInt xmax, uInt y)
 {
   const auto& ec = TCAP(t_erase_chars);
+  const auto& ce = TCAP(t_clr_eol);
   const auto& rp = TCAP(t_repeat_char);
+  const auto& lr = TCAP(t_repeat_last_char);
   uInt x = xmin;
   uInt x_last = x;
   auto* min_char = &vterm->getFChar(int(x), int(y));
   auto* print_char = min_char;
+  findUnchangedSpans (xmin, xmax, y);
+  auto span = unchanged_spans.cbegin();
 
   while ( x <= xmax )
   {
@@ -773,20 +1053,20 @@ void FTermOutput::printRange (uInt xmin, uInt xmax, uInt y)
     replaceNonPrintableFullwidth (x, *print_char);
 
     // skip character with no changes
-    if ( skipUnchangedCharacters(x, xmax, y) )
+    if ( skipUnchangedCharacters(x, y, span) )
     {
       x++;
       continue;
     }
 
     // Erase character
-    if ( ec && print_char->ch[0] == L' ' )
+    if ( (ec || ce) && print_char->ch[0] == L' ' )
     {
       if ( eraseCharacters(x, xmax, y) \
            == PrintState::LineCompletelyPrinted )
         break;
     }
-    else if ( rp )  // Repeat one character n-fold
+    else if ( rp || lr )  // Repeat one character n-fold
     {
       repeatCharacter(x, xmax, y);
     }
@@ -960,10 +1240,9 @@ auto FTermOutput::eraseCharacters (uInt& x, uInt xmax, uInt y) -> PrintState
 {
   // Erase a number of characters to draw simple whitespaces
 
-  const auto& ec = TCAP(t_erase_chars);
   auto& print_char = vterm->getFChar(static_cast<int>(x), static_cast<int>(y));
 
-  if ( ! ec || print_char.ch[0] != L' ' )
+  if ( print_char.ch[0] != L' ' )
     return PrintState::NothingPrinted;
 
   const auto whitespace = countRepetitions(&print_char, x, xmax);
@@ -977,23 +1256,36 @@ auto FTermOutput::eraseCharacters (uInt& x, uInt xmax, uInt y) -> PrintState
 
   const uInt start_pos = x;
   const uInt end_pos = x + whitespace - 1;
-
-  if ( canUseEraseCharacters(print_char, whitespace) )
+  uInt repetition_cost{};
+  const auto repetition_type = getRepetitionType ( print_char, whitespace
+                                                 , repetition_cost );
+  const auto erasure_type = getErasureType ( print_char, {start_pos, end_pos}
+                                           , repetition_cost );
+  auto state = PrintState::WhitespacesPrinted;
+
+  if ( erasure_type == Erasure::EraseCharacters )
   {
+    const auto& ec = TCAP(t_erase_chars);
     appendAttributes (print_char);
     appendOutputBuffer (FTermControl{FTermcap::encodeParameter(ec, whitespace)});
 
-    if ( end_pos <= xmax )
-      setCursor (FPoint{static_cast<int>(x + whitespace), static_cast<int>(y)});
+    if ( end_pos < uInt(vterm->size.width) - 1 )
+      setCursor (FPoint{static_cast<int>(end_pos + 1), static_cast<int>(y)});
     else
-      return PrintState::LineCompletelyPrinted;
+      state = PrintState::LineCompletelyPrinted;
+  }
+  else if ( erasure_type == Erasure::ClearToEOL )
+  {
+    appendAttributes (print_char);
+    appendOutputBuffer (FTermControl{TCAP(t_clr_eol)});
+    state = PrintState::LineCompletelyPrinted;
   }
   else
-    appendCharacter_n (print_char, whitespace);
+    appendRepetitions (print_char, repetition_type, whitespace);
 
   markAsPrinted (start_pos, end_pos, y);
   x = end_pos;
-  return PrintState::WhitespacesPrinted;
+  return state;
 }
 
 //----------------------------------------------------------------------
@@ -1020,30 +1312,39 @@ auto FTermOutput::repeatCharacter (uInt& x, uInt xmax, uInt y) -> PrintState
   // Every full-width character is always followed by a padding
   // character, so that two or more consecutive full-width characters
   // cannot repeat in their byte sequence
-  const auto repetition_type = getRepetitionType(print_char, repetitions);
+  uInt cost{};
+  const auto repetition_type = getRepetitionType(print_char, repetitions, cost);
+  appendRepetitions (print_char, repetition_type, repetitions);
+  const uInt start_pos = x;
+  const uInt end_pos = x + repetitions - 1;
+  markAsPrinted (start_pos, end_pos, y);
+  x = end_pos;
+  return PrintState::RepeatCharacterPrinted;
+}
 
-  if ( rp && repetition_type == Repetition::ASCII )
+//----------------------------------------------------------------------
+void FTermOutput::appendRepetitions ( FChar& print_char
+                                    , Repetition repetition_type
+                                    , uInt repetitions )
+{
+  if ( repetition_type == Repetition::ASCII )
   {
+    const auto& rp = TCAP(t_repeat_char);
     newFontChanges (print_char);
     charsetChanges (print_char);
     appendAttributes (print_char);
     appendOutputBuffer (FTermControl{FTermcap::encodeParameter(rp, print_char.ch[0], repetitions)});
     term_pos->x_ref() += static_cast<int>(repetitions);
   }
-  else if ( lr && repetition_type == Repetition::UTF8 )
+  else if ( repetition_type == Repetition::UTF8 )
   {
+    const auto& lr = TCAP(t_repeat_last_char);
     appendChar (print_char);
     appendOutputBuffer (FTermControl{FTermcap::encodeParameter(lr, repetitions)});
     term_pos->x_ref() += static_cast<int>(repetitions);
   }
   else
     appendCharacter_n (print_char, repetitions);
-
-  const uInt start_pos = x;
-  const uInt end_pos = x + repetitions - 1;
-  markAsPrinted (start_pos, end_pos, y);
-  x = end_pos;
-  return PrintState::RepeatCharacterPrinted;
 }
 
 //----------------------------------------------------------------------
@@ -1068,39 +1369,149 @@ inline auto FTermOutput::countRepetitions ( const FChar* print_char
 }
 
 //----------------------------------------------------------------------
-inline auto FTermOutput::canUseEraseCharacters ( const FChar& print_char
-                                               , uInt whitespace ) const -> bool
+inline auto FTermOutput::getCharacterLength (const FChar& print_char) const -> uInt
 {
-  const auto normal = FOptiAttr::isNormal(print_char);
-  const auto ut = FTermcap::background_color_erase;
-  const uInt total_length_required = erase_char_length
-                                   + cursor_address_length;
+  // Number of bytes of a character in the output stream
 
-  return whitespace > total_length_required && (ut || normal);
+  if ( internal::var::terminal_encoding != Encoding::UTF8 )
+    return 1;
+
+  return internal::getUTF8Length(print_char.ch[0]);
 }
 
 //----------------------------------------------------------------------
-inline auto FTermOutput::canUseCharacterRepetitions ( const FChar& print_char
-                                                    , uInt repetitions ) const -> bool
+inline auto FTermOutput::getParameterLength ( const ParameterLengths& lengths
+                                            , uInt num ) const -> uInt
 {
-  return repetitions > repeat_char_length
-      && print_char.ch[0] != L'\0' && print_char.ch[1] == L'\0';
+  // Length of a parameterized sequence with the number num
+
+  std::size_t digits{1};
+
+  while ( num >= 10 && digits < MAX_PARAMETER_DIGITS )
+  {
+    num /= 10;
+    digits++;
+  }
+
+  return lengths[digits];
 }
 
 //----------------------------------------------------------------------
-inline auto FTermOutput::getRepetitionType ( const FChar& print_char
-                                           , uInt repetitions ) const -> Repetition
+inline auto FTermOutput::canUseCharacterRepetitions (const FChar& print_char) const -> bool
 {
-  if ( canUseCharacterRepetitions(print_char, repetitions) )
+  return print_char.ch[0] != L'\0' && print_char.ch[1] == L'\0';
+}
+
+//----------------------------------------------------------------------
+auto FTermOutput::getRepetitionType ( const FChar& print_char
+                                    , uInt repetitions
+                                    , uInt& cost ) const -> Repetition
+{
+  // Selects the output with the fewest bytes for a run of
+  // identical characters and returns its length in cost
+
+  cost = repetitions * getCharacterLength(print_char);
+  auto repetition_type = Repetition::NotOptimized;
+
+  if ( cost <= MIN_CONTROL_LENGTH || ! canUseCharacterRepetitions(print_char) )
+    return repetition_type;
+
+  const auto& rp = TCAP(t_repeat_char);
+  const auto& lr = TCAP(t_repeat_last_char);
+  const auto ch = print_char.ch[0];
+
+  if ( rp && is7bit(ch) )
   {
-    if ( is7bit(print_char.ch[0]) )
-      return Repetition::ASCII;
+    const auto length = getParameterLength(repeat_char_lengths, repetitions);
 
-    if ( isPrintable(print_char.ch[0]) )
-      return Repetition::UTF8;
+    if ( length > 0 && length < cost )
+    {
+      cost = length;
+      repetition_type = Repetition::ASCII;
+    }
+  }
+
+  if ( lr && isPrintable(ch) )
+  {
+    const auto length = getParameterLength(repeat_last_char_lengths, repetitions);
+
+    if ( length > 0 && length + getCharacterLength(print_char) < cost )
+    {
+      cost = length + getCharacterLength(print_char);
+      repetition_type = Repetition::UTF8;
+    }
+  }
+
+  return repetition_type;
+}
+
+//----------------------------------------------------------------------
+auto FTermOutput::getErasureType ( const FChar& print_char
+                                 , const CharSpan& whitespace
+                                 , uInt cost ) const -> Erasure
+{
+  // Compares the bytes for erasing a whitespace run (including the
+  // following cursor motion) with the cost of printing it. Every
+  // variant starts with the same SGR sequence for the attributes of
+  // print_char, so it is not part of the comparison. The font and
+  // charset changes that printing may need are not counted either.
+
+  auto erasure_type = Erasure::NotOptimized;
+
+  if ( cost <= MIN_CONTROL_LENGTH || ! isErasable(print_char) )
+    return erasure_type;
+
+  const auto& ec = TCAP(t_erase_chars);
+  const auto& ce = TCAP(t_clr_eol);
+  const uInt count = whitespace.end - whitespace.start + 1;
+
+  if ( ce && whitespace.end == uInt(vterm->size.width) - 1
+    && clr_eol_length < cost )
+  {
+    cost = clr_eol_length;
+    erasure_type = Erasure::ClearToEOL;
+  }
+
+  if ( ! ec )
+    return erasure_type;
+
+  auto length = getParameterLength(erase_chars_lengths, count);
+
+  if ( whitespace.end < uInt(vterm->size.width) - 1 )
+  {
+    // The cursor remains at the beginning of the erased characters.
+    // As in skipUnchangedCharacters(), the cursor address length
+    // is the upper limit for the following cursor motion.
+    if ( cursor_address_length >= cost )
+      return erasure_type;
+
+    length += cursor_address_length;
   }
 
-  return Repetition::NotOptimized;
+  if ( length > 0 && length < cost )
+    erasure_type = Erasure::EraseCharacters;
+
+  return erasure_type;
+}
+
+//----------------------------------------------------------------------
+inline auto FTermOutput::isErasable (const FChar& ch) const -> bool
+{
+  // Can erased cells replace this whitespace character?
+  // Erasing fills the cells with the current background color only
+  // on terminals with back_color_erase (ut), otherwise with the
+  // default colors. No other attribute is transferred, so attributes
+  // that are visible on a blank cell must not be set.
+
+  if ( FOptiAttr::isNormal(ch) )
+    return true;
+
+  if ( ! FTermcap::background_color_erase )
+    return false;
+
+  const auto& attr = ch.attr.bit;
+  return ! ( attr.underline || attr.dbl_underline || attr.crossed_out
+          || attr.reverse || attr.standout );
 }
 
 //----------------------------------------------------------------------
@@ -1115,6 +1526,63 @@ inline auto FTermOutput::isFullWidthPaddingChar (const FChar& ch) const -> bool
   return ch.attr.bit.fullwidth_padding;
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::canScrollTerminalRegion (const FRect& region) const -> bool
+{
+  // Without left and right margins, only regions with
+  // the full terminal width can be scrolled
+
+  if ( ! TCAP(t_change_scroll_region) || region.getHeight() < 2 )
+    return false;
+
+  return ! hasHorizontalMargins(region) || hasLeftRightMargins();
+}
+
+//----------------------------------------------------------------------
+inline auto FTermOutput::hasLeftRightMargins() const -> bool
+{
+  return TCAP(t_enter_lr_margin_mode)
+      && TCAP(t_set_lr_margins)
+      && TCAP(t_exit_lr_margin_mode);
+}
+
+//----------------------------------------------------------------------
+inline auto FTermOutput::hasHorizontalMargins (const FRect& region) const -> bool
+{
+  return region.getX1() > 0 || region.getX2() < vterm->size.width - 1;
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::setScrollRegion (const FRect& region)
+{
+  const auto& cs = TCAP(t_change_scroll_region);
+  appendOutputBuffer (FTermControl{FTermcap::encodeParameter(cs, region.getY1(), region.getY2())});
+
+  if ( hasHorizontalMargins(region) )
+  {
+    // Enable the left and right margin mode
+    // and set the left and right margins
+    const auto& lr = TCAP(t_set_lr_margins);
+    appendOutputBuffer (FTermControl{TCAP(t_enter_lr_margin_mode)});
+    appendOutputBuffer (FTermControl{FTermcap::encodeParameter(lr, region.getX1(), region.getX2())});
+  }
+
+  // Setting the scroll region moves the cursor to the home position
+  term_pos->setPoint(-1, -1);
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::resetScrollRegion (const FRect& region)
+{
+  const auto& cs = TCAP(t_change_scroll_region);
+
+  if ( hasHorizontalMargins(region) )
+    appendOutputBuffer (FTermControl{TCAP(t_exit_lr_margin_mode)});  // Resets the margins
+
+  appendOutputBuffer (FTermControl{FTermcap::encodeParameter(cs, 0, vterm->size.height - 1)});
+  term_pos->setPoint(-1, -1);
+}
+
 //----------------------------------------------------------------------
 void FTermOutput::cursorWrap() const
 {
@@ -1167,15 +1635,16 @@ inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
   // Updates pending changes from line y to the terminal
 
   auto& vterm_changes = vterm->changes[y];
-  uInt& xmin = vterm_changes.xmin;
-  uInt& xmax = vterm_changes.xmax;
 
-  if ( xmin > xmax )  // This line has no changes
+  if ( vterm_changes.getSpanCount() == 0 )  // This line has no changes
   {
     cursorWrap();
     return false;
   }
 
+  uInt xmin = vterm_changes.getXmin();
+  uInt xmax = vterm_changes.getXmax();
+
   // Clear rest of line
   if ( canClearToEOL (xmin, y) )
   {
@@ -1199,7 +1668,7 @@ inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
       markAsPrinted (0, xmin, y);
     }
 
-    printRange (xmin, xmax, y);
+    printSpans (vterm_changes, xmin, xmax, y);
 
     if ( draw_trailing_ws )
     {
@@ -1211,8 +1680,7 @@ inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
   }
 
   // Reset line changes and wrap the cursor
-  xmin = uInt(vterm->size.width);
-  xmax = 0;
+  vterm_changes.reset (uInt(vterm->size.width));
   cursorWrap();
   return true;
 }
@@ -1233,6 +1701,42 @@ auto FTermOutput::updateTerminalCursor() -> bool
   return false;
 }
 
+//----------------------------------------------------------------------
+void FTermOutput::beginSynchronizedUpdate()
+{
+  // The terminal holds back the rendering until the end of the update
+
+  if ( ! sync_update_support || sync_update_active )
+    return;
+
+  output_buffer.append(CSI "?2026h");
+  sync_update_active = true;
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::endSynchronizedUpdate()
+{
+  // The terminal renders the complete update at once
+
+  if ( ! sync_update_active )
+    return;
+
+  static constexpr char begin_sync[] = CSI "?2026h";
+  static constexpr auto begin_length = sizeof(begin_sync) - 1;
+  sync_update_active = false;
+
+  if ( output_buffer.size() >= begin_length
+    && output_buffer.compare( output_buffer.size() - begin_length
+                            , begin_length, begin_sync ) == 0 )
+  {
+    // Nothing was output since the beginning of the update
+    output_buffer.resize(output_buffer.size() - begin_length);
+    return;
+  }
+
+  output_buffer.append(CSI "?2026l");
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutput::flushTimeAdjustment()
 {
@@ -1241,14 +1745,14 @@ inline void FTermOutput::flushTimeAdjustment()
 
   if ( diff > milliseconds(400) )
   {
-    flush_wait = MIN_FLUSH_WAIT;  // Reset to minimum values after 400 ms
-    flush_average = MIN_FLUSH_WAIT;
-    flush_median = MIN_FLUSH_WAIT;
+    flush_wait = min_flush_wait;  // Reset to minimum values after 400 ms
+    flush_average = min_flush_wait;
+    flush_median = min_flush_wait;
   }
   else
   {
     auto usec = uInt64(duration_cast<microseconds>(diff).count());
-    usec = std::min(std::max(usec, MIN_FLUSH_WAIT), MAX_FLUSH_WAIT);
+    usec = std::min(std::max(usec, min_flush_wait), max_flush_wait);
 
     if ( usec >= flush_average )
       flush_average += (usec - flush_average) / 10;
@@ -1270,7 +1774,8 @@ inline void FTermOutput::flushTimeAdjustment()
         flush_median -= delta;
     }
 
-    flush_wait = flush_median;
+    // Wait at least as long as the terminal needed for the last writes
+    flush_wait = std::min(std::max(flush_median, write_time), max_flush_wait);
   }
 }
 
@@ -1325,9 +1830,12 @@ inline void FTermOutput::newFontChanges (FChar& next_char) const
 }
 
 //----------------------------------------------------------------------
-inline void FTermOutput::charsetChanges (FChar& next_char) const
+inline void FTermOutput::charsetChanges (FChar& next_char)
 {
-  auto iter_enc_ch = next_char.encoded_char.begin();
+  // The encoded output character is only needed during output and
+  // is therefore not stored in each FChar cell of the virtual terminal
+  encoded_char = {{ L'\0' }};
+  auto iter_enc_ch = encoded_char.begin();
   auto iter_ch = next_char.ch.cbegin();
   auto end_ch = next_char.ch.cend();
 
@@ -1349,7 +1857,7 @@ inline void FTermOutput::charsetChanges (FChar& next_char) const
   if ( ch_enc == ch )
     return;
 
-  auto& first_enc_char = next_char.encoded_char[0];
+  auto& first_enc_char = encoded_char[0];
 
   if ( ch_enc == 0 )
   {
@@ -1405,19 +1913,24 @@ inline void FTermOutput::appendCharacter_n (FChar& next_char, uInt number)
 //----------------------------------------------------------------------
 inline void FTermOutput::appendChar (FChar& next_char)
 {
+  static const auto& opti_attr = FOptiAttr::getInstance();
   newFontChanges (next_char);
   charsetChanges (next_char);
   appendAttributes (next_char);
-  characterFilter (next_char);
 
-  for (const auto& ch : next_char.encoded_char)
+  if ( opti_attr.isInvisibleSimulated(next_char) )
+    encoded_char[0] = L' ';
+
+  characterFilter();
+
+  for (const auto& ch : encoded_char)
   {
     if ( ch != L'\0')
     {
       if ( internal::var::terminal_encoding == Encoding::UTF8 )
-        appendOutputBuffer (unicode_to_utf8(ch));
+        appendUTF8Char (ch);
       else
-        appendOutputBuffer (std::string(1, char(uChar(ch))));
+        appendOutputBuffer (char(uChar(ch)));
     }
 
     if ( ! combined_char_support )
@@ -1496,14 +2009,14 @@ void FTermOutput::appendLowerRight (FChar& last_char)
 }
 
 //----------------------------------------------------------------------
-inline void FTermOutput::characterFilter (FChar& next_char)
+inline void FTermOutput::characterFilter()
 {
   static const auto& sub_map = getFTerm().getCharSubstitutionMap();
 
   if ( sub_map.isEmpty() )
     return;
 
-  auto& first_enc_char = next_char.encoded_char[0];
+  auto& first_enc_char = encoded_char[0];
   const auto& entry = sub_map.getMappedChar(first_enc_char);
 
   if ( entry )
@@ -1530,38 +2043,97 @@ inline auto FTermOutput::moveCursorLeft() -> CursorMoved
 //----------------------------------------------------------------------
 inline void FTermOutput::checkFreeBufferSize()
 {
-  if ( output_buffer->isFull() )
+  if ( output_buffer.size() >= MAX_BUFFER_SIZE )
     flush();
 }
 
 //----------------------------------------------------------------------
-inline void FTermOutput::appendOutputBuffer (const FTermControl& ctrl)
+void FTermOutput::appendOutputBuffer (const FTermControl& ctrl)
 {
-  output_buffer->emplace(OutputType::Control, ctrl.string);
+  const auto& string = ctrl.string;
+
+  if ( string.find("$<") != std::string::npos )  // Has delay padding
+    padding_segments.push_back({output_buffer.size(), string.length()});
+
+  output_buffer.append(string);
   checkFreeBufferSize();
 }
 
 //----------------------------------------------------------------------
 inline void FTermOutput::appendOutputBuffer (const UniChar& ch)
 {
-  appendOutputBuffer(unicode_to_utf8(wchar_t(ch)));
+  appendUTF8Char (wchar_t(ch));
 }
 
 //----------------------------------------------------------------------
-void FTermOutput::appendOutputBuffer (std::string&& string)
+inline void FTermOutput::appendOutputBuffer (char ch)
 {
-  auto& last = output_buffer->back();
+  output_buffer.push_back(ch);
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::appendUTF8Char (wchar_t wide_char)
+{
+  // Encodes the character directly into the output buffer
+
+  const auto ucs = uInt32(wide_char);
 
-  if ( ! output_buffer->isEmpty() && last.type == OutputType::String )
+  if ( ucs < 0x80 )  // 1 Byte (7-bit): 0xxxxxxx
   {
-    // Append string data to the back element
-    auto& string_buf = last.data;
-    string_buf.append(string);
+    output_buffer.push_back(char(ucs));
+  }
+  else if ( ucs < 0x800 )  // 2 byte (11-bit): 110xxxxx 10xxxxxx
+  {
+    output_buffer.push_back(char(0xc0 | uChar(ucs >> 6u)));
+    output_buffer.push_back(char(0x80 | uChar(ucs & 0x3f)));
+  }
+  else if ( ucs < 0x10000 )  // 3 byte (16-bit): 1110xxxx 10xxxxxx 10xxxxxx
+  {
+    output_buffer.push_back(char(0xe0 | uChar(ucs >> 12u)));
+    output_buffer.push_back(char(0x80 | uChar((ucs >> 6u) & 0x3f)));
+    output_buffer.push_back(char(0x80 | uChar(ucs & 0x3f)));
+  }
+  else if ( ucs < 0x200000 )  // 4 byte (21-bit): 11110xxx 10xxxxxx ...
+  {
+    output_buffer.push_back(char(0xf0 | uChar(ucs >> 18u)));
+    output_buffer.push_back(char(0x80 | uChar((ucs >> 12u) & 0x3f)));
+    output_buffer.push_back(char(0x80 | uChar((ucs >> 6u) & 0x3f)));
+    output_buffer.push_back(char(0x80 | uChar(ucs & 0x3f)));
   }
   else
+    appendUTF8Char (L'�');  // Invalid character
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::writeOutputBuffer (const char* data, std::size_t length) const
+{
+  // Writes the data to the terminal with as few system calls as possible
+
+  static const auto& fsystem = FSystem::getInstance();
+  const int stdout_no{FTermios::getStdOut()};
+
+  while ( length > 0 )
   {
-    output_buffer->emplace(OutputType::String, std::move(string));
-    checkFreeBufferSize();
+    const auto bytes = fsystem->write(stdout_no, data, length);
+
+    if ( bytes < 0 )
+    {
+      if ( errno == EINTR )
+        continue;
+
+      if ( errno != EAGAIN && errno != EWOULDBLOCK )
+        return;  // Output error
+
+      // Wait until the non-blocking terminal is writable again
+      fd_set ofds{};
+      FD_ZERO(&ofds);
+      FD_SET(stdout_no, &ofds);
+      fsystem->select (stdout_no + 1, nullptr, &ofds, nullptr, nullptr);
+      continue;
+    }
+
+    data += bytes;
+    length -= std::size_t(bytes);
   }
 }
 
@@ -40,22 +40,26 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <array>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "final/output/foutput.h"
 #include "final/output/tty/fterm.h"
 
+#if defined(UNIT_TEST)
+  class FTermOutputTest;  // Unit test fixture with access to the internals
+#endif
+
 namespace finalcut
 {
 
 // class forward declaration
 class FStartOptions;
 class FTermData;
-template <typename T, std::size_t Capacity>
-class FRingBuffer;
 
 //----------------------------------------------------------------------
 // class FTermOutput
@@ -81,6 +85,7 @@ class FTermOutput final : public FOutput
     auto getMaxColor() const -> int override;
     auto getEncoding() const -> Encoding override;
     auto getKeyName (FKey) const -> FString override;
+    auto getTargetFrameRate() const -> uInt override;
 
     // Mutators
     void setCursor (FPoint) override;
@@ -91,6 +96,7 @@ class FTermOutput final : public FOutput
     auto setVGAFont() -> bool override;
     auto setNewFont() -> bool override;
     void setNonBlockingRead (bool = true) override;
+    void setTargetFrameRate (uInt) override;
 
     // Inquiries
     auto isCursorHideable() const -> bool override;
@@ -114,6 +120,8 @@ class FTermOutput final : public FOutput
     void initScreenSettings() override;
     auto scrollTerminalForward() -> bool override;
     auto scrollTerminalReverse() -> bool override;
+    auto scrollTerminalRegionForward (const FRect&) -> bool override;
+    auto scrollTerminalRegionReverse (const FRect&) -> bool override;
     void clearTerminalAttributes() override;
     void clearTerminalState() override;
     auto clearTerminal (wchar_t = L' ') -> bool override;
@@ -121,6 +129,10 @@ class FTermOutput final : public FOutput
     void beep() const override;
 
   private:
+#if defined(UNIT_TEST)
+    friend class ::FTermOutputTest;
+#endif
+
     // Constants
     struct FTermControl
     {
@@ -143,25 +155,25 @@ class FTermOutput final : public FOutput
       NotOptimized
     };
 
-    enum class OutputType : uInt8  // Output data type of the terminal
+    enum class Erasure
     {
-      String,
-      Control
+      EraseCharacters,
+      ClearToEOL,
+      NotOptimized
     };
 
     enum class CursorMoved { No, Yes };
 
-    struct OutputData
+    struct PaddingSegment  // Control string with termcap padding
     {
-      OutputData() = default;
-
-      OutputData (OutputType t, std::string s)
-        : type{t}
-        , data{std::move(s)}
-      { }
+      std::size_t offset;  // Position in the output buffer
+      std::size_t length;  // Length of the control string
+    };
 
-      OutputType  type{OutputType::String};
-      std::string data{};
+    struct CharSpan
+    {
+      uInt start;  // First column
+      uInt end;    // Last column
     };
 
     // Constants
@@ -169,10 +181,17 @@ class FTermOutput final : public FOutput
     static constexpr uInt64 MIN_FLUSH_WAIT = 16'667;   //  16.6 ms = 60 Hz
     static constexpr uInt64 MAX_FLUSH_WAIT = 200'000;  // 200.0 ms = 5 Hz
     //   Output buffer size
-    static constexpr std::size_t BUFFER_SIZE = 32'768;  // 32 KB
-
-    // Using-declaration
-    using OutputBuffer = FRingBuffer<OutputData, BUFFER_SIZE>;
+    static constexpr std::size_t BUFFER_SIZE = 32'768;      //  32 KB (initial)
+    static constexpr std::size_t MAX_BUFFER_SIZE = 262'144;  // 256 KB (flush)
+    //   Shortest control sequence (e.g. ESC [ b)
+    static constexpr uInt MIN_CONTROL_LENGTH = 3;
+    //   Decimal digits of a precalculated parameter length
+    static constexpr std::size_t MAX_PARAMETER_DIGITS = 5;
+
+    // Using-declarations
+    using PaddingList = std::vector<PaddingSegment>;
+    using SpanList = std::vector<CharSpan>;
+    using ParameterLengths = std::array<uInt, MAX_PARAMETER_DIGITS + 1>;
 
     // Accessors
     auto getFSetPaletteRef() const & -> const FSetPalette& override;
@@ -184,11 +203,14 @@ class FTermOutput final : public FOutput
     void redefineColorPalette() override;
     void restoreColorPalette() override;
     void init_characterLengths();
+    void init_parameterLengths();
     void init_combined_character();
     auto canClearToEOL (uInt, uInt) const -> bool;
     auto canClearLeadingWS (uInt&, uInt) const -> bool;
     auto canClearTrailingWS (uInt&, uInt) const -> bool;
-    auto skipUnchangedCharacters (uInt&, uInt, uInt) -> bool;
+    void findUnchangedSpans (uInt, uInt, uInt);
+    auto skipUnchangedCharacters (uInt&, uInt, SpanList::const_iterator&) -> bool;
+    void printSpans (const FVTerm::FLineChanges&, uInt, uInt, uInt);
     void printRange (uInt, uInt, uInt);
     void replaceNonPrintableFullwidth (uInt, FChar&) const;
     void printCharacter (uInt&, uInt, bool, FChar&);
@@ -199,51 +221,75 @@ class FTermOutput final : public FOutput
     void skipPaddingCharacter (uInt&, uInt, const FChar&) const;
     auto eraseCharacters (uInt&, uInt, uInt) -> PrintState;
     auto repeatCharacter (uInt&, uInt, uInt) -> PrintState;
+    void appendRepetitions (FChar&, Repetition, uInt);
     auto countRepetitions (const FChar*, uInt, uInt) const -> uInt;
-    auto canUseEraseCharacters (const FChar&, uInt) const -> bool;
-    auto canUseCharacterRepetitions (const FChar&, uInt) const -> bool;
-    auto getRepetitionType (const FChar&, uInt) const -> Repetition;
+    auto getCharacterLength (const FChar&) const -> uInt;
+    auto getParameterLength (const ParameterLengths&, uInt) const -> uInt;
+    auto canUseCharacterRepetitions (const FChar&) const -> bool;
+    auto getRepetitionType (const FChar&, uInt, uInt&) const -> Repetition;
+    auto getErasureType (const FChar&, const CharSpan&, uInt) const -> Erasure;
+    auto isErasable (const FChar&) const -> bool;
     auto isFullWidthChar (const FChar&) const -> bool;
     auto isFullWidthPaddingChar (const FChar&) const -> bool;
+    auto canScrollTerminalRegion (const FRect&) const -> bool;
+    auto hasLeftRightMargins() const -> bool;
+    auto hasHorizontalMargins (const FRect&) const -> bool;
+    void setScrollRegion (const FRect&);
+    void resetScrollRegion (const FRect&);
     void cursorWrap() const;
     void adjustCursorPosition (FPoint&) const;
     auto updateTerminalLine (uInt) -> bool;
     auto updateTerminalCursor() -> bool;
+    void beginSynchronizedUpdate();
+    void endSynchronizedUpdate();
     void flushTimeAdjustment();
     void markAsPrinted (uInt, uInt) const;
     void markAsPrinted (uInt, uInt, uInt) const;
     void newFontChanges (FChar&) const;
-    void charsetChanges (FChar&) const;
+    void charsetChanges (FChar&);
     void appendCharacter (FChar&);
     void appendCharacter_n (FChar&, uInt);
     void appendChar (FChar&);
     void appendAttributes (FChar&);
     void appendLowerRight (FChar&);
-    void characterFilter (FChar&);
+    void characterFilter();
     auto moveCursorLeft() -> CursorMoved;
     void checkFreeBufferSize();
     void appendOutputBuffer (const FTermControl&);
     void appendOutputBuffer (const UniChar&);
-    void appendOutputBuffer (std::string&&);
+    void appendOutputBuffer (char);
+    void appendUTF8Char (wchar_t);
+    void writeOutputBuffer (const char*, std::size_t) const;
 
     // Data members
     FTerm                         fterm{};
     static FVTerm::FTermArea*     vterm;
     static FTermData*             fterm_data;
-    std::shared_ptr<OutputBuffer> output_buffer{};
+    std::string                   output_buffer{};
+    PaddingList                   padding_segments{};
+    std::string                   padding_string{};  // Reused by flush()
     std::shared_ptr<FPoint>       term_pos{};  // terminal cursor position
     TimeValue                     time_last_flush{};
+    SpanList                      unchanged_spans{};
     FChar                         term_attribute{};
+    FUnicode                      encoded_char{};  // Encoded output character
     bool                          cursor_hideable{false};
     bool                          combined_char_support{false};
-    uInt                          erase_char_length{};
-    uInt                          repeat_char_length{};
+    bool                          sync_update_support{false};
+    bool                          sync_update_active{false};
     uInt                          clr_bol_length{};
     uInt                          clr_eol_length{};
     uInt                          cursor_address_length{};
+    ParameterLengths              repeat_char_lengths{};  // Per digit count
+    ParameterLengths              repeat_last_char_lengths{};
+    ParameterLengths              erase_chars_lengths{};
+    uInt                          target_frame_rate{0};  // 0 = default
+    uInt64                        min_flush_wait{MIN_FLUSH_WAIT};
+    uInt64                        max_flush_wait{MAX_FLUSH_WAIT};
     uInt64                        flush_wait{MIN_FLUSH_WAIT};
     uInt64                        flush_average{MIN_FLUSH_WAIT};
     uInt64                        flush_median{MIN_FLUSH_WAIT};
+    uInt64                        write_time{0};  // Average write duration
 };
 
 // FTermOutput inline functions
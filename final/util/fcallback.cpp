@@ -20,6 +20,8 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <memory>
+
 #include "final/util/fcallback.h"
 
 namespace finalcut
@@ -30,23 +32,40 @@ namespace finalcut
 //----------------------------------------------------------------------
 
 // public methods of FCallback
+//----------------------------------------------------------------------
+auto FCallback::getSignalId (const FString& cb_signal) -> FSignalId
+{
+  // Returns the identifier of the given signal name.
+  // Unknown names get the next free identifier.
+
+  auto& signal_ids = getSignalIdMap();
+  const auto& name = cb_signal.toString();
+  const auto iter = signal_ids.find(name);
+
+  if ( iter != signal_ids.end() )
+    return iter->second;
+
+  const auto signal_id = FSignalId(signal_ids.size());
+  signal_ids.emplace(name, signal_id);
+  return signal_id;
+}
+
 //----------------------------------------------------------------------
 void FCallback::delCallback (const FString& cb_signal)
 {
   // Deletes entries with the given signal from the callback list
 
-  if ( callback_objects.empty() )
+  FSignalId signal_id{};
+
+  if ( callback_buckets.empty()
+    || ! findSignalId(cb_signal.toString(), signal_id) )
     return;
 
-  auto iter = callback_objects.cbegin();
+  const auto bucket = findBucket(signal_id);
 
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_signal == cb_signal )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  if ( bucket )
+    callback_buckets.erase ( callback_buckets.begin()
+                           + (bucket - callback_buckets.data()) );
 }
 
 //----------------------------------------------------------------------
@@ -54,7 +73,40 @@ void FCallback::delCallback()
 {
   // Delete all callbacks from this widget
 
-  callback_objects.clear();  // function pointer
+  callback_buckets.clear();  // function pointer
+}
+
+//----------------------------------------------------------------------
+void FCallback::emitCallback (FSignalId emit_signal) const
+{
+  // Initiate callback for the given signal identifier
+
+  for (std::size_t n{0}; ; n++)
+  {
+    // The bucket is looked up again after each call, because
+    // a callback function can add or remove callbacks
+    const auto bucket = findBucket(emit_signal);
+
+    if ( ! bucket || n >= bucket->callback_objects.size() )
+      return;
+
+    // Calling the stored function pointer
+    bucket->callback_objects[n].cb_function();
+  }
+}
+
+//----------------------------------------------------------------------
+void FCallback::emitCallback (const char* emit_signal) const
+{
+  // Initiate callback for the given signal
+
+  FSignalId signal_id{};
+
+  if ( callback_buckets.empty() || ! emit_signal
+    || ! findSignalId(emit_signal, signal_id) )
+    return;
+
+  emitCallback(signal_id);
 }
 
 //----------------------------------------------------------------------
@@ -62,18 +114,54 @@ void FCallback::emitCallback (const FString& emit_signal) const
 {
   // Initiate callback for the given signal
 
-  if ( callback_objects.empty() )
+  FSignalId signal_id{};
+
+  if ( callback_buckets.empty()
+    || ! findSignalId(emit_signal.toString(), signal_id) )
     return;
 
-  for (auto&& cback : callback_objects)
-  {
-    if ( cback.cb_signal == emit_signal )
-    {
-      // Calling the stored function pointer
-      cback.cb_function();
-    }
-  }
+  emitCallback(signal_id);
 }
 
-}  // namespace finalcut
 
+// private methods of FCallback
+//----------------------------------------------------------------------
+auto FCallback::getSignalIdMap() -> FSignalIdMap&
+{
+  static const auto& signal_ids = std::make_unique<FSignalIdMap>();
+  return *signal_ids;
+}
+
+//----------------------------------------------------------------------
+auto FCallback::getCallbackObjects (FString&& cb_signal) -> FCallbackObjects&
+{
+  // Returns the callback list of the given signal
+  // and creates it if it does not yet exist
+
+  const auto signal_id = getSignalId(cb_signal);
+  auto bucket = findBucket(signal_id);
+
+  if ( bucket )
+    return bucket->callback_objects;
+
+  callback_buckets.push_back({signal_id, {}});
+  return callback_buckets.back().callback_objects;
+}
+
+//----------------------------------------------------------------------
+auto FCallback::findSignalId ( const std::string& cb_signal
+                             , FSignalId& signal_id ) -> bool
+{
+  // Looks up a signal name without registering it
+
+  const auto& signal_ids = getSignalIdMap();
+  const auto iter = signal_ids.find(cb_signal);
+
+  if ( iter == signal_ids.end() )
+    return false;
+
+  signal_id = iter->second;
+  return true;
+}
+
+}  // namespace finalcut
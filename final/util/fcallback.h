@@ -35,6 +35,9 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <algorithm>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -47,6 +50,9 @@ namespace finalcut
 // class forward declaration
 class FWidget;
 
+// Using-declaration
+using FSignalId = uInt32;
+
 //----------------------------------------------------------------------
 // struct FCallbackData
 //----------------------------------------------------------------------
@@ -57,9 +63,8 @@ struct FCallbackData
   FCallbackData() = default;
 
   template <typename FuncPtr>
-  FCallbackData (FString&& s, FWidget* i, FuncPtr m, FCall&& c)
-    : cb_signal(std::move(s))
-    , cb_instance(i)
+  FCallbackData (FWidget* i, FuncPtr m, FCall&& c)
+    : cb_instance(i)
     , cb_function_ptr(m)
     , cb_function(std::move(c))
   { }
@@ -71,7 +76,6 @@ struct FCallbackData
   auto operator = (FCallbackData&&) noexcept -> FCallbackData& = default;
 
   // Data members
-  FString   cb_signal{};
   FWidget*  cb_instance{};
   void*     cb_function_ptr{};
   FCall     cb_function{};
@@ -147,6 +151,7 @@ class FCallback
     // Accessors
     auto getClassName() const -> FString;
     auto getCallbackCount() const -> std::size_t;
+    static auto getSignalId (const FString&) -> FSignalId;
 
     // Methods
     template <typename Object
@@ -206,14 +211,38 @@ class FCallback
             , enable_if_FunctionReference_t<Function> = nullptr>
     void delCallback (const Function& cb_function);
     void delCallback();
-    void emitCallback (const FString& emit_signal) const;
+    void emitCallback (FSignalId) const;
+    void emitCallback (const char*) const;
+    void emitCallback (const FString&) const;
 
   private:
     // Using-declaration
     using FCallbackObjects = std::vector<FCallbackData>;
 
+    struct FCallbackBucket
+    {
+      FSignalId        signal_id;
+      FCallbackObjects callback_objects;
+    };
+
+    using FCallbackBuckets = std::vector<FCallbackBucket>;
+    using FSignalIdMap = std::unordered_map<std::string, FSignalId>;
+
+    // Accessors
+    static auto getSignalIdMap() -> FSignalIdMap&;
+    auto getCallbackObjects (FString&&) -> FCallbackObjects&;
+    auto findBucket (FSignalId) const -> const FCallbackBucket*;
+    auto findBucket (FSignalId) -> FCallbackBucket*;
+
+    // Methods
+    static auto findSignalId (const std::string&, FSignalId&) -> bool;
+    template <typename Predicate>
+    void removeCallbacks (Predicate&&);
+    template <typename Predicate>
+    void removeCallbacks (const FString&, Predicate&&);
+
     // Data members
-    FCallbackObjects  callback_objects{};
+    FCallbackBuckets  callback_buckets{};
 };
 
 // FCallback inline functions
@@ -223,7 +252,14 @@ inline auto FCallback::getClassName() const -> FString
 
 //----------------------------------------------------------------------
 inline auto FCallback::getCallbackCount() const -> std::size_t
-{ return callback_objects.size(); }
+{
+  std::size_t count{0};
+
+  for (const auto& bucket : callback_buckets)
+    count += bucket.callback_objects.size();
+
+  return count;
+}
 
 //----------------------------------------------------------------------
 template <typename Object
@@ -242,7 +278,7 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   auto fn = std::bind ( std::forward<Function>(cb_member)
                       , std::forward<Object>(cb_instance)
                       , std::forward<Args>(args)... );
-  callback_objects.emplace_back (std::move(cb_signal), instance, nullptr, fn);
+  getCallbackObjects(std::move(cb_signal)).emplace_back (instance, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -259,7 +295,7 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   // Add a function object to an instance as callback
 
   auto fn = std::bind (std::forward<Function>(cb_function), std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), cb_instance, nullptr, fn);
+  getCallbackObjects(std::move(cb_signal)).emplace_back (cb_instance, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -274,7 +310,7 @@ inline void FCallback::addCallback ( FString&&  cb_signal
 
   auto fn = std::bind ( std::forward<Function>(cb_function)
                       , std::forward<Args>(args)... );
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, nullptr, fn);
+  getCallbackObjects(std::move(cb_signal)).emplace_back (nullptr, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -288,7 +324,7 @@ inline void FCallback::addCallback ( FString&& cb_signal
   // Add a function object reference as callback
 
   auto fn = std::bind (cb_function, std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, nullptr, fn);
+  getCallbackObjects(std::move(cb_signal)).emplace_back (nullptr, nullptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -303,7 +339,7 @@ inline void FCallback::addCallback ( FString&& cb_signal
 
   auto ptr = reinterpret_cast<void*>(&cb_function);
   auto fn = std::bind (cb_function, std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, ptr, fn);
+  getCallbackObjects(std::move(cb_signal)).emplace_back (nullptr, ptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -319,7 +355,7 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   auto ptr = reinterpret_cast<void*>(cb_function);
   auto fn = std::bind ( std::forward<Function>(cb_function)
                       , std::forward<Args>(args)... );
-  callback_objects.emplace_back(std::move(cb_signal), nullptr, ptr, fn);
+  getCallbackObjects(std::move(cb_signal)).emplace_back (nullptr, ptr, fn);
 }
 
 //----------------------------------------------------------------------
@@ -329,18 +365,10 @@ inline void FCallback::delCallback (Object&& cb_instance) noexcept
 {
   // Deletes entries with the given instance from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_instance == cb_instance )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  removeCallbacks ( [&cb_instance] (const FCallbackData& data)
+                    {
+                      return data.cb_instance == cb_instance;
+                    } );
 }
 
 //----------------------------------------------------------------------
@@ -352,19 +380,11 @@ inline void FCallback::delCallback ( const FString& cb_signal
   // Deletes entries with the given signal and instance
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_signal == cb_signal
-      && iter->cb_instance == cb_instance )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  removeCallbacks ( cb_signal
+                  , [&cb_instance] (const FCallbackData& data)
+                    {
+                      return data.cb_instance == cb_instance;
+                    } );
 }
 
 //----------------------------------------------------------------------
@@ -375,19 +395,11 @@ inline void FCallback::delCallback (FunctionPtr&& cb_func_ptr) noexcept
   // Deletes entries with the given function pointer
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
   auto ptr = reinterpret_cast<void*>(cb_func_ptr);
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_function_ptr == ptr )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  removeCallbacks ( [ptr] (const FCallbackData& data)
+                    {
+                      return data.cb_function_ptr == ptr;
+                    } );
 }
 
 //----------------------------------------------------------------------
@@ -398,21 +410,81 @@ inline void FCallback::delCallback (const Function& cb_function)
   // Deletes entries with the given function reference
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
   auto ptr = reinterpret_cast<void*>(&cb_function);
-  auto iter = callback_objects.cbegin();
+  removeCallbacks ( [ptr] (const FCallbackData& data)
+                    {
+                      return data.cb_function_ptr == ptr;
+                    } );
+}
+
+//----------------------------------------------------------------------
+inline auto FCallback::findBucket (FSignalId signal_id) const -> const FCallbackBucket*
+{
+  // A widget uses only a few different signals,
+  // so a linear search is faster than a hash lookup
+
+  for (const auto& bucket : callback_buckets)
+    if ( bucket.signal_id == signal_id )
+      return &bucket;
 
-  while ( iter != callback_objects.cend() )
+  return nullptr;
+}
+
+//----------------------------------------------------------------------
+inline auto FCallback::findBucket (FSignalId signal_id) -> FCallbackBucket*
+{
+  const auto& self = *this;
+  return const_cast<FCallbackBucket*>(self.findBucket(signal_id));
+}
+
+//----------------------------------------------------------------------
+template <typename Predicate>
+inline void FCallback::removeCallbacks (Predicate&& predicate)
+{
+  // Deletes matching entries from all signals
+
+  auto iter = callback_buckets.begin();
+
+  while ( iter != callback_buckets.end() )
   {
-    if ( iter->cb_function_ptr == ptr )
-      iter = callback_objects.erase(iter);
+    auto& objects = iter->callback_objects;
+    objects.erase ( std::remove_if(objects.begin(), objects.end(), predicate)
+                  , objects.end() );
+
+    if ( objects.empty() )
+      iter = callback_buckets.erase(iter);
     else
       ++iter;
   }
 }
 
+//----------------------------------------------------------------------
+template <typename Predicate>
+inline void FCallback::removeCallbacks ( const FString& cb_signal
+                                       , Predicate&& predicate )
+{
+  // Deletes matching entries of the given signal
+
+  FSignalId signal_id{};
+
+  if ( callback_buckets.empty()
+    || ! findSignalId(cb_signal.toString(), signal_id) )
+    return;
+
+  auto bucket = findBucket(signal_id);
+
+  if ( ! bucket )
+    return;
+
+  auto& objects = bucket->callback_objects;
+  objects.erase ( std::remove_if(objects.begin(), objects.end(), predicate)
+                , objects.end() );
+
+  if ( objects.empty() )
+    callback_buckets.erase ( callback_buckets.begin()
+                           + (bucket - callback_buckets.data()) );
+}
+
 }  // namespace finalcut
 
 #endif  // FCALLBACK_H
@@ -39,6 +39,9 @@
   using timer_t = void*;
 #endif
 
+#include <sys/select.h>
+
+#include <csignal>
 #include <memory>
 #include <pwd.h>
 
@@ -74,6 +77,8 @@ class FSystem
     virtual auto pipe (PipeData&) -> int = 0;
     virtual auto open (const char*, int, ...) -> int = 0;
     virtual auto close (int) -> int = 0;
+    virtual auto write (int, const void*, std::size_t) -> ssize_t = 0;
+    virtual auto select (int, fd_set*, fd_set*, fd_set*, struct timeval*) -> int = 0;
     virtual auto fopen (const char*, const char*) -> FILE* = 0;
     virtual auto fclose (FILE*) -> int = 0;
     virtual auto fputs (const char*, FILE*) -> int = 0;
@@ -90,6 +95,13 @@ class FSystem
     virtual auto kevent ( int, const struct kevent*
                         , int, struct kevent*
                         , int, const struct timespec* ) -> int = 0;
+    virtual auto timerfd_create (int, int) -> int = 0;
+    virtual auto timerfd_settime ( int, int
+                                 , const struct itimerspec*
+                                 , struct itimerspec* ) -> int = 0;
+    virtual auto signalfd (int, const sigset_t*, int) -> int = 0;
+    virtual auto pthread_sigmask ( int, const sigset_t*
+                                 , sigset_t* ) -> int = 0;
     virtual auto getuid() -> uid_t = 0;
     virtual auto geteuid() -> uid_t = 0;
     virtual auto getpwuid_r ( uid_t, struct passwd*, char*
@@ -31,10 +31,16 @@
   #include <sys/time.h>
 #endif
 
+#if defined(__linux__)
+  #include <sys/signalfd.h>
+  #include <sys/timerfd.h>
+#endif
+
 #if defined(__CYGWIN__)
   #include "final/fconfig.h"  // need for getpwuid_r and realpath
 #endif
 
+#include <cerrno>
 #include <csignal>
 
 #include "final/util/fsystemimpl.h"
@@ -159,6 +165,71 @@ auto FSystemImpl::kevent ( int, const struct kevent*
 
 #endif
 
+//----------------------------------------------------------------------
+#if defined(__linux__)
+
+auto FSystemImpl::timerfd_create (int clockid, int flags) -> int
+{
+  return ::timerfd_create (clockid, flags);
+}
+
+#else
+
+auto FSystemImpl::timerfd_create (int, int) -> int
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+#if defined(__linux__)
+
+auto FSystemImpl::timerfd_settime ( int fd, int flags
+                                  , const struct itimerspec* new_value
+                                  , struct itimerspec* old_value ) -> int
+{
+  return ::timerfd_settime (fd, flags, new_value, old_value);
+}
+
+#else
+
+auto FSystemImpl::timerfd_settime ( int, int
+                                  , const struct itimerspec*
+                                  , struct itimerspec* ) -> int
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+#if defined(__linux__)
+
+auto FSystemImpl::signalfd (int fd, const sigset_t* mask, int flags) -> int
+{
+  return ::signalfd (fd, mask, flags);
+}
+
+#else
+
+auto FSystemImpl::signalfd (int, const sigset_t*, int) -> int
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+auto FSystemImpl::pthread_sigmask ( int how, const sigset_t* set
+                                  , sigset_t* oldset ) -> int
+{
+  return ::pthread_sigmask (how, set, oldset);
+}
+
 //----------------------------------------------------------------------
 auto FSystemImpl::getpwuid_r ( uid_t uid, struct passwd* pwd
                              , char* buf, size_t buflen
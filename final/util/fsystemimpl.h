@@ -60,6 +60,7 @@
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/select.h>
 
 #include <cstdarg>
 #include <fcntl.h>
@@ -143,6 +144,18 @@ class FSystemImpl : public FSystem
       return ::close(file_descriptor);
     }
 
+    inline auto write ( int file_descriptor, const void* buf
+                      , std::size_t count ) -> ssize_t override
+    {
+      return ::write(file_descriptor, buf, count);
+    }
+
+    inline auto select ( int nfds, fd_set* readfds, fd_set* writefds
+                       , fd_set* exceptfds, struct timeval* timeout ) -> int override
+    {
+      return ::select(nfds, readfds, writefds, exceptfds, timeout);
+    }
+
     inline auto fopen (const char* path, const char* mode) -> FILE* override
     {
       return std::fopen (path, mode);
@@ -179,6 +192,13 @@ class FSystemImpl : public FSystem
     auto kevent ( int, const struct ::kevent*
                 , int, struct ::kevent*
                 , int, const struct timespec* ) -> int override;
+    auto timerfd_create (int, int) -> int override;
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override;
+    auto signalfd (int, const sigset_t*, int) -> int override;
+    auto pthread_sigmask ( int, const sigset_t*
+                         , sigset_t* ) -> int override;
 
     inline auto getuid() -> uid_t override
     {
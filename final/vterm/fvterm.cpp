@@ -20,8 +20,17 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <csignal>
+#include <cwctype>
+#include <functional>
+#include <mutex>
 #include <numeric>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -53,6 +62,170 @@ struct var
 bool  var::fvterm_initialized{false};
 uInt8 var::b1_transparent_mask{};
 
+//----------------------------------------------------------------------
+// class BandWorkerPool
+//----------------------------------------------------------------------
+
+class BandWorkerPool  // Worker threads for the band-parallel compositing
+{
+  public:
+    // Using-declaration
+    using BandJob = std::function<void(std::size_t)>;
+
+    // Constructor
+    explicit BandWorkerPool (std::size_t);
+
+    // Disable copy constructor
+    BandWorkerPool (const BandWorkerPool&) = delete;
+
+    // Destructor
+    ~BandWorkerPool();
+
+    // Disable copy assignment operator (=)
+    auto operator = (const BandWorkerPool&) -> BandWorkerPool& = delete;
+
+    // Accessor
+    auto getThreadCount() const noexcept -> std::size_t;
+
+    // Method
+    void run (std::size_t, const BandJob&);
+
+  private:
+    // Methods
+    void workerLoop();
+    void processBands();
+
+    // Data members
+    std::vector<std::thread>  workers{};
+    std::mutex                mutex{};
+    std::condition_variable   start_cv{};
+    std::condition_variable   done_cv{};
+    const BandJob*            job{nullptr};
+    std::size_t               band_count{0};
+    std::atomic<std::size_t>  next_band{0};
+    std::size_t               busy_workers{0};
+    uInt64                    generation{0};
+    bool                      stop{false};
+};
+
+//----------------------------------------------------------------------
+BandWorkerPool::BandWorkerPool (std::size_t threads)
+{
+  // The calling thread processes bands too
+  workers.reserve(threads - 1);
+
+  // The workers inherit a signal mask that blocks all asynchronous
+  // signals, so that e.g. SIGWINCH is always delivered to the main thread
+  static const auto& fsystem = FSystem::getInstance();
+  sigset_t worker_mask{};
+  sigset_t old_mask{};
+  sigfillset (&worker_mask);
+
+  for (const auto sig : {SIGBUS, SIGFPE, SIGILL, SIGSEGV, SIGTRAP})
+    sigdelset (&worker_mask, sig);  // Synchronous signals
+
+  const bool mask_changed = \
+      fsystem->pthread_sigmask(SIG_SETMASK, &worker_mask, &old_mask) == 0;
+
+  for (std::size_t i{1}; i < threads; i++)
+  {
+    try
+    {
+      workers.emplace_back ([this] () { workerLoop(); });
+    }
+    catch (const std::system_error&)
+    {
+      break;  // Continue with the threads already started
+    }
+  }
+
+  if ( mask_changed )  // Restore the signal mask of the calling thread
+    fsystem->pthread_sigmask(SIG_SETMASK, &old_mask, nullptr);
+}
+
+//----------------------------------------------------------------------
+BandWorkerPool::~BandWorkerPool()  // destructor
+{
+  {
+    std::lock_guard<std::mutex> lock_guard(mutex);
+    stop = true;
+  }
+
+  start_cv.notify_all();
+
+  for (auto& worker : workers)
+    worker.join();
+}
+
+//----------------------------------------------------------------------
+inline auto BandWorkerPool::getThreadCount() const noexcept -> std::size_t
+{
+  return workers.size() + 1;
+}
+
+//----------------------------------------------------------------------
+void BandWorkerPool::run (std::size_t bands, const BandJob& band_job)
+{
+  // Calls band_job for every band number from 0 to bands - 1
+  // and returns when all bands are processed
+
+  {
+    std::lock_guard<std::mutex> lock_guard(mutex);
+    job = &band_job;
+    band_count = bands;
+    next_band = 0;
+    busy_workers = workers.size();
+    generation++;
+  }
+
+  start_cv.notify_all();
+  processBands();
+  std::unique_lock<std::mutex> lock(mutex);
+  done_cv.wait (lock, [this] () { return busy_workers == 0; });
+  job = nullptr;
+}
+
+//----------------------------------------------------------------------
+void BandWorkerPool::workerLoop()
+{
+  uInt64 last_generation{0};
+
+  while ( true )
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      start_cv.wait ( lock, [this, &last_generation] ()
+                            { return stop || generation != last_generation; } );
+
+      if ( stop )
+        return;
+
+      last_generation = generation;
+    }
+
+    processBands();
+    std::lock_guard<std::mutex> lock_guard(mutex);
+    busy_workers--;
+
+    if ( busy_workers == 0 )
+      done_cv.notify_one();
+  }
+}
+
+//----------------------------------------------------------------------
+inline void BandWorkerPool::processBands()
+{
+  for (auto band = next_band++; band < band_count; band = next_band++)
+    (*job)(band);
+}
+
+//----------------------------------------------------------------------
+static auto getBandWorkerPool() -> std::unique_ptr<BandWorkerPool>&
+{
+  static auto pool = std::unique_ptr<BandWorkerPool>{};
+  return pool;
+}
+
 }  // namespace internal
 
 // static class attributes
@@ -60,7 +233,10 @@ bool                 FVTerm::draw_completed{false};
 bool                 FVTerm::skip_one_vterm_update{false};
 bool                 FVTerm::no_terminal_updates{false};
 bool                 FVTerm::force_terminal_update{false};
+bool                 FVTerm::deferred_vterm_update{false};
 FVTerm::FTermArea*   FVTerm::active_area{nullptr};
+FVTerm::FTermArea*   FVTerm::dirty_areas{nullptr};
+uInt64               FVTerm::dirty_area_inserts{0};
 uInt8                FVTerm::b1_print_trans_mask{};
 int                  FVTerm::tabstop{8};
 
@@ -139,6 +315,20 @@ auto FVTerm::getPrintCursor() -> FPoint
   return {0, 0};  // Fallback coordinates
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::getCompositingThreads() -> std::size_t
+{
+  const auto& pool = internal::getBandWorkerPool();
+  return pool ? pool->getThreadCount() : 1;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getTargetFrameRate() -> uInt
+{
+  static const auto& init_object = getGlobalFVTermInstance();
+  return init_object->foutput->getTargetFrameRate();
+}
+
 //----------------------------------------------------------------------
 void FVTerm::setTerminalUpdates (TerminalUpdate refresh_state) const
 {
@@ -173,6 +363,34 @@ void FVTerm::setNonBlockingRead (bool enable)
   init_object->foutput->setNonBlockingRead (enable);
 }
 
+//----------------------------------------------------------------------
+void FVTerm::setTargetFrameRate (uInt fps)
+{
+  // Sets the maximum number of terminal updates per second.
+  // Drawing between two frames is composited in the next frame.
+
+  static const auto& init_object = getGlobalFVTermInstance();
+  init_object->foutput->setTargetFrameRate (fps);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::setCompositingThreads (std::size_t threads)
+{
+  // With more than one thread, large layers are split into bands
+  // of lines that are added to the virtual terminal in parallel.
+  // The default (0 or 1) uses the serial path.
+
+  auto& pool = internal::getBandWorkerPool();
+
+  if ( pool && pool->getThreadCount() == threads )
+    return;
+
+  pool.reset();
+
+  if ( threads > 1 )
+    pool = std::make_unique<internal::BandWorkerPool>(threads);
+}
+
 //----------------------------------------------------------------------
 auto FVTerm::hasPreprocessingHandler (const FVTerm* instance) noexcept -> bool
 {
@@ -239,8 +457,7 @@ void FVTerm::putVTerm() const
   for (auto i{0}; i < vterm->size.height; i++)
   {
     auto& vterm_changes = vterm->changes[unsigned(i)];
-    vterm_changes.xmin = 0;
-    vterm_changes.xmax = uInt(vterm->size.width - 1);
+    vterm_changes.set (0, uInt(vterm->size.width - 1));
   }
 
   updateTerminal();
@@ -261,19 +478,77 @@ auto FVTerm::updateTerminal() const -> bool
   return terminal_updated;
 }
 
+//----------------------------------------------------------------------
+void FVTerm::beginUpdate()
+{
+  // Holds back the changes of the print area from the virtual
+  // terminal until the matching endUpdate() call. The lock
+  // covers the whole area, not only the calling object.
+
+  if ( update_area )
+    return;
+
+  update_area = getPrintArea();
+
+  if ( update_area )
+    update_area->update_locks++;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::endUpdate()
+{
+  // The collected changes are added to the virtual
+  // terminal with the next terminal update
+
+  if ( ! update_area )
+    return;
+
+  if ( update_area->update_locks > 0 )
+    update_area->update_locks--;
+
+  update_area = nullptr;
+}
+
 //----------------------------------------------------------------------
 void FVTerm::reduceTerminalLineUpdates (uInt y)
 {
   static const auto& init_object = getGlobalFVTermInstance();
   static const auto& vterm = init_object->vterm;
-  static const auto& vterm_old = init_object->vterm_old;
   auto& vterm_changes = vterm->changes[unsigned(y)];
-  uInt& xmin = vterm_changes.xmin;
-  uInt& xmax = vterm_changes.xmax;
+  const auto span_count = vterm_changes.getSpanCount();
 
-  if ( xmin > xmax )  // No changes
+  if ( span_count == 0 )  // No changes
     return;
 
+  std::array<FLineChanges::FSpan, FLineChanges::MAX_SPANS> reduced{};
+  std::size_t count{0};
+
+  for (std::size_t i{0}; i < span_count; i++)
+  {
+    auto span = vterm_changes.getSpan(i);
+
+    if ( reduceTerminalSpanUpdates(span.xmin, span.xmax, y) )
+    {
+      reduced[count] = span;
+      count++;
+    }
+  }
+
+  vterm_changes.reset (uInt(vterm->size.width));
+
+  for (std::size_t i{0}; i < count; i++)
+    vterm_changes.mark (reduced[i].xmin, reduced[i].xmax);
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::reduceTerminalSpanUpdates (uInt& xmin, uInt& xmax, uInt y) -> bool
+{
+  // Removes unchanged characters from both ends of the span and
+  // marks unchanged characters inside the span
+
+  static const auto& init_object = getGlobalFVTermInstance();
+  static const auto& vterm = init_object->vterm;
+  static const auto& vterm_old = init_object->vterm_old;
   const auto* first = &vterm->getFChar(int(xmin), int(y));
   const auto* first_old = &vterm_old->getFChar(int(xmin), int(y));
   auto* last = &vterm->getFChar(int(xmax), int(y));
@@ -293,6 +568,9 @@ void FVTerm::reduceTerminalLineUpdates (uInt y)
     last_old--;
   }
 
+  if ( last < first )  // No changes
+    return false;
+
   while ( last > first )
   {
     if ( *last == *last_old )
@@ -301,6 +579,8 @@ void FVTerm::reduceTerminalLineUpdates (uInt y)
     last--;
     last_old--;
   }
+
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -317,6 +597,9 @@ void FVTerm::addPreprocessingHandler ( const FVTerm* instance
   auto obj = std::make_unique<FVTermPreprocessing> \
       (instance, std::move(function));
   print_area->preproc_list.emplace_back(std::move(obj));
+
+  if ( instance->child_print_area )  // Window that processes the child area
+    instance->child_print_area->preproc_owner = print_area;
 }
 
 //----------------------------------------------------------------------
@@ -337,6 +620,11 @@ void FVTerm::delPreprocessingHandler (const FVTerm* instance)
     else
       ++iter;
   }
+
+  const auto child_area = instance->child_print_area;
+
+  if ( child_area && child_area->preproc_owner == print_area )
+    child_area->preproc_owner = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -447,6 +735,9 @@ auto FVTerm::print (FTermArea* area, const FVTermBuffer& buffer) const noexcept
   if ( ! area || buffer.isEmpty() )
     return -1;
 
+  if ( printRun(area, buffer) )
+    return int(buffer.getLength());
+
   for (const auto& fchar : buffer)
   {
     if ( print(area, fchar) == -1 )  // Print next character
@@ -558,6 +849,31 @@ auto FVTerm::getPrintArea() -> FTermArea*
   return vdesktop.get();
 }
 
+//----------------------------------------------------------------------
+void FVTerm::setChildPrintArea (FTermArea* area)
+{
+  if ( child_print_area && child_print_area != area )
+    child_print_area->preproc_owner = nullptr;
+
+  child_print_area = area;
+
+  if ( ! area || ! print_area )
+    return;
+
+  // Remember the window whose preprocessing handler copies the area
+  const auto& preproc_list = print_area->preproc_list;
+  const auto iter = std::find_if ( preproc_list.cbegin()
+                                 , preproc_list.cend()
+                                 , [this] (const auto& pcall)
+                                   {
+                                     return pcall->instance.get() == this;
+                                   }
+                                 );
+
+  if ( iter != preproc_list.cend() )
+    area->preproc_owner = print_area;
+}
+
 //----------------------------------------------------------------------
 auto FVTerm::createArea (const FShadowBox& shadowbox) -> std::unique_ptr<FTermArea>
 {
@@ -714,8 +1030,7 @@ void FVTerm::getArea (const FPoint& pos, FTermArea* area) const noexcept
     auto& ac = area->getFChar(0, y);  // area character
     putAreaLine (tc, ac, unsigned(length));
     auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = uInt(length - 1);
+    line_changes.set (0, uInt(length - 1));
   }
 }
 
@@ -751,76 +1066,115 @@ void FVTerm::getArea (const FRect& box, FTermArea* area) const noexcept
     auto& ac = area->getFChar(dx, dy + line);  // area character
     putAreaLine (tc, ac, unsigned(length));
     auto& line_changes = area->changes[unsigned(dy + line)];
-    line_changes.xmin = std::min(line_changes.xmin, uInt(dx));
-    line_changes.xmax = std::max(line_changes.xmax, uInt(dx + length - 1));
+    line_changes.mark (uInt(dx), uInt(dx + length - 1));
   }
 }
 
 //----------------------------------------------------------------------
 void FVTerm::addLayer (FTermArea* area) const noexcept
 {
-  // Transmit changes in area to the virtual terminal (add layer to vterm)
+  // Transmit changes in area to the virtual terminal (add layer to vterm).
+  // Characters hidden under a higher window are not written.
 
   if ( ! area || ! area->visible )
     return;
 
-  const int ax = std::max(area->position.x, 0);
-  const int ol = std::max(0, -area->position.x);  // Outside left
   const int ay = area->position.y;
-  const int width = getFullAreaWidth(area);
   const int height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
   const int y_end = std::min(vterm->size.height - ay, height);
 
   // Call the preprocessing handler methods (child area change handling)
   callPreprocessingHandler(area);
 
-  for (auto y{0}; y < y_end; y++)  // Line loop
+  const auto& coverage = updateCoverageMap();
+  const int index = getCoverageIndex(coverage, area);
+  const auto& pool = internal::getBandWorkerPool();
+  const auto window_count = coverage.windows.size();
+  const auto bands = pool ? std::min ( pool->getThreadCount() * 2
+                                     , std::size_t(std::max(y_end, 0) / MIN_BAND_HEIGHT) )
+                          : 0;
+
+  if ( bands > 1 )
   {
-    auto& line_changes = area->changes[unsigned(y)];
-    auto line_xmin = int(line_changes.xmin);
-    auto line_xmax = int(line_changes.xmax);
-    line_xmin = std::max(line_xmin, ol);
-    line_xmax = std::min(line_xmax, vterm->size.width + ol - ax - 1);
+    // Each band of area lines only writes to its own terminal rows.
+    // The windows in the coverage map are not modified in the meantime.
+    std::vector<std::vector<bool>> band_overlaps(bands);
+    const auto band_job = [&] (std::size_t band)
+    {
+      auto& overlap = band_overlaps[band];
+      overlap.resize(window_count);
+      addLayerLines ( coverage, index, area
+                    , int(std::size_t(y_end) * band / bands)
+                    , int(std::size_t(y_end) * (band + 1) / bands)
+                    , overlap );
+    };
+    pool->run (bands, band_job);
+
+    for (const auto& overlap : band_overlaps)
+      markOverlappingWindows (coverage, overlap);
+  }
+  else
+  {
+    std::vector<bool> overlap(window_count);
+    addLayerLines (coverage, index, area, 0, y_end, overlap);
+    markOverlappingWindows (coverage, overlap);
+  }
 
-    if ( line_xmin > line_xmax )
-      continue;
+  vterm->has_changes = true;
+  updateVTermCursor(area);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::addLayerLines ( const FCoverageMap& coverage, int index
+                           , FTermArea* area, int y_begin, int y_end
+                           , std::vector<bool>& overlap ) const noexcept
+{
+  // Transmit the changed lines y_begin to y_end - 1 of the area to
+  // the virtual terminal. Windows above that need an update are
+  // marked in overlap.
+
+  const int ax = std::max(area->position.x, 0);
+  const int ol = std::max(0, -area->position.x);  // Outside left
+  const int ay = area->position.y;
+  const int width = getFullAreaWidth(area);
 
-    const std::size_t length = unsigned(line_xmax - line_xmin + 1);
+  for (auto y{y_begin}; y < y_end; y++)  // Line loop
+  {
+    auto& line_changes = area->changes[unsigned(y)];
+    const auto line = line_changes;  // Pending changes of this line
+    const auto span_count = line.getSpanCount();
     const int tx = ax - ol;  // Global terminal positions for x
     const int ty = ay + y;  // Global terminal positions for y
 
-    if ( ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
-      continue;
-
-    // Area character
-    const auto& ac = area->getFChar(line_xmin, y);
+    // Line with hidden and transparent characters
+    const bool has_transparency = line.trans_count > 0;
 
-    // Terminal character
-    auto& tc = vterm->getFChar(tx + line_xmin, ty);
+    if ( span_count > 0 )
+      line_changes.reset (uInt(width));
 
-    if ( line_changes.trans_count > 0 )
-    {
-      // Line with hidden and transparent characters
-      addAreaLineWithTransparency (&ac, &tc, length);
-    }
-    else
+    for (std::size_t i{0}; i < span_count; i++)  // Span loop
     {
-      // Line has only covered characters
-      putAreaLine (ac, tc, length);
-    }
+      const auto span = line.getSpan(i);
+      const auto line_xmin = std::max(int(span.xmin), ol);
+      const auto line_xmax = std::min(int(span.xmax), vterm->size.width + ol - ax - 1);
 
-    int new_xmin = ax + line_xmin - ol;
-    int new_xmax = ax + line_xmax;
-    auto& vterm_changes = vterm->changes[unsigned(ty)];
-    vterm_changes.xmin = std::min(vterm_changes.xmin, uInt(new_xmin));
-    new_xmax = std::min(new_xmax, vterm->size.width - 1);
-    vterm_changes.xmax = std::max (vterm_changes.xmax, uInt(new_xmax));
-    line_changes.xmin = uInt(width);
-    line_changes.xmax = 0;
-  }
+      if ( line_xmin > line_xmax
+        || ax + line_xmin >= vterm->size.width
+        || tx + line_xmin + ol < 0 || ty < 0 )
+      {
+        // Keep the invisible span for a later update
+        line_changes.mark (span.xmin, span.xmax);
+        continue;
+      }
 
-  vterm->has_changes = true;
-  updateVTermCursor(area);
+      if ( index < -1 )  // Area is not in the coverage map
+        addLayerRun (area, ty, tx + line_xmin, tx + line_xmax, has_transparency);
+      else
+        addCoveredLayerLine ( coverage, index, area, ty
+                            , tx + line_xmin, tx + line_xmax
+                            , has_transparency, overlap );
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -878,8 +1232,7 @@ void FVTerm::copyArea (FTermArea* dst, const FPoint& pos, const FTermArea* const
       putAreaLine (*sc, *dc, unsigned(length));
     }
 
-    dst_changes.xmin = std::min(uInt(ax), dst_changes.xmin);
-    dst_changes.xmax = std::max(uInt(ax + length - 1), dst_changes.xmax);
+    dst_changes.mark (uInt(ax), uInt(ax + length - 1));
   }
 
   dst->has_changes = true;
@@ -923,8 +1276,7 @@ void FVTerm::scrollAreaForward (FTermArea* area)
     const auto& sc = area->getFChar(0, y + 1);  // source character
     putAreaLine (sc, dc, unsigned(area->size.width));
     auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = uInt(x_max);
+    line_changes.set (0, uInt(x_max));
   }
 
   // insert a new line below
@@ -937,12 +1289,13 @@ void FVTerm::scrollAreaForward (FTermArea* area)
   auto& dc = area->getFChar(0, y_max);  // destination character
   std::fill (&dc, &dc + area->size.width, nc);
   auto& new_line_changes = area->changes[unsigned(y_max)];
-  new_line_changes.xmin = 0;
-  new_line_changes.xmax = uInt(x_max);
+  new_line_changes.set (0, uInt(x_max));
   area->has_changes = true;
 
   if ( area == vdesktop.get() )
     scrollTerminalForward();  // Scrolls the terminal up one line
+  else
+    scrollTerminalRegionForward(getTerminalScrollRegion(area));
 }
 
 //----------------------------------------------------------------------
@@ -962,8 +1315,7 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
     const auto& sc = area->getFChar(0, y - 1);  // source character
     putAreaLine (sc, dc, unsigned(area->size.width));
     auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = uInt(x_max);
+    line_changes.set (0, uInt(x_max));
   }
 
   // insert a new line above
@@ -976,12 +1328,13 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
   auto& dc = area->getFChar(0, 0);  // destination character
   std::fill (&dc, &dc + area->size.width, nc);
   auto& new_line_changes = area->changes[unsigned(y_max)];
-  new_line_changes.xmin = 0;
-  new_line_changes.xmax = uInt(x_max);
+  new_line_changes.set (0, uInt(x_max));
   area->has_changes = true;
 
   if ( area == vdesktop.get() )
     scrollTerminalReverse();  // Scrolls the terminal down one line
+  else
+    scrollTerminalRegionReverse(getTerminalScrollRegion(area));
 }
 
 //----------------------------------------------------------------------
@@ -1016,8 +1369,7 @@ void FVTerm::clearArea (FTermArea* area, wchar_t fillchar) noexcept
   for (auto i{0}; i < area->size.height; i++)
   {
     auto& line_changes = area->changes[unsigned(i)];
-    line_changes.xmin = 0;
-    line_changes.xmax = width - 1;
+    line_changes.set (0, width - 1);
 
     if ( nc.attr.bit.transparent
       || nc.attr.bit.color_overlay
@@ -1033,8 +1385,7 @@ void FVTerm::clearArea (FTermArea* area, wchar_t fillchar) noexcept
   {
     const int y = area->size.height + i;
     auto& line_changes = area->changes[unsigned(y)];
-    line_changes.xmin = 0;
-    line_changes.xmax = width - 1;
+    line_changes.set (0, width - 1);
     line_changes.trans_count = width;
   }
 
@@ -1058,6 +1409,15 @@ auto FVTerm::processTerminalUpdate() const -> bool
   if ( foutput->hasTerminalResized() )
     return false;
 
+  // Coalesce all drawing until the next frame is due
+  if ( ! (foutput->isFlushTimeout() || isTerminalUpdateForced()) )
+  {
+    deferred_vterm_update = dirty_areas != nullptr;
+    return false;
+  }
+
+  deferred_vterm_update = false;
+
   // Update data on VTerm
   if ( skip_one_vterm_update )
     skip_one_vterm_update = false;
@@ -1142,14 +1502,14 @@ inline void FVTerm::resetTextAreaToDefault ( FTermArea* area
   FChar default_char
   {
     { { L' ',  L'\0', L'\0', L'\0', L'\0' } },
-    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     FColor::Default,
     FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
   };
   std::fill (area->data.begin(), area->data.end(), default_char);
 
-  FLineChanges unchanged { uInt(size.getWidth()), 0, 0 };
+  FLineChanges unchanged{};
+  unchanged.reset (uInt(size.getWidth()));
   std::fill (area->changes.begin(), area->changes.end(), unchanged);
 }
 
@@ -1180,38 +1540,51 @@ auto FVTerm::isCovered (const FPoint& pos, const FTermArea* area) const noexcept
 {
   // Determines the covered state for the given position
 
-  const auto& win_list = getWindowList();
-  auto is_covered = CoveredState::None;
-  bool found{ area == vdesktop.get() };
+  // Only the windows between the area and the topmost window
+  // at this position are checked
 
-  if ( ! area || ! win_list || win_list->empty()
-    || win_list->back()->getVWin() == area )
+  const int x = pos.getX();
+  const int y = pos.getY();
+
+  if ( ! area || ! vterm || y < 0 || y >= vterm->size.height )
+    return CoveredState::None;
+
+  const auto& coverage = updateCoverageMap();
+  const int index = getCoverageIndex(coverage, area);
+
+  if ( index < -1 )  // Area is not in the coverage map
+    return CoveredState::None;
+
+  const auto& spans = coverage.rows[unsigned(y)];
+  const auto span = std::find_if ( spans.cbegin(), spans.cend()
+                                 , [x] (const FCoverageSpan& s)
+                                   {
+                                     return x <= s.x_end;
+                                   }
+                                 );
+
+  if ( span == spans.cend() || x < span->x_start )
     return CoveredState::None;
 
-  for (const auto& win_obj : *win_list)
+  auto is_covered = CoveredState::None;
+
+  for (auto i{span->index}; i > index; i--)
   {
-    const auto& win = win_obj->getVWin();
+    const auto& win = coverage.windows[std::size_t(i)];
 
-    if ( ! (win && win->visible) )
+    if ( x < win.x1 || x > win.x2 || y < win.y1 || y > win.y2 )
       continue;
 
-    if ( found && win->contains(pos) )  // is covered
-    {
-      const auto& tmp = win->getFChar( pos.getX() - win->position.x
-                                     , pos.getY() - win->position.y );
+    const auto& tmp = win.area->getFChar(x - win.x1, y - win.y1);
 
-      if ( tmp.attr.bit.color_overlay )
-      {
-        is_covered = CoveredState::Half;
-      }
-      else if ( ! tmp.attr.bit.transparent )
-      {
-        return CoveredState::Full;
-      }
+    if ( tmp.attr.bit.color_overlay )
+    {
+      is_covered = CoveredState::Half;
+    }
+    else if ( ! tmp.attr.bit.transparent )
+    {
+      return CoveredState::Full;
     }
-
-    if ( area == win )
-      found = true;
   }
 
   return is_covered;
@@ -1289,105 +1662,287 @@ constexpr auto FVTerm::getFullAreaHeight (const FTermArea* area) const noexcept
 }
 
 //----------------------------------------------------------------------
-void FVTerm::passChangesToOverlap (const FTermArea* area) const
+auto FVTerm::getCoverageMap() -> FCoverageMap&
 {
-  const auto& win_list = getWindowList();
-  bool found{false};
-
-  if ( ! area || ! win_list || win_list->empty() )
-    return;
-
-  for (auto&& win_obj : *win_list)
-  {
-    const auto& win = win_obj->getVWin();
-
-    if ( found && win && win->visible && win->isOverlapped(area) )
-    {
-      // Pass changes to the found window
-      passChangesToOverlappingWindow (win, area);
-    }
-
-    if ( area == win )
-      found = true;
-  }
+  static const auto& coverage = std::make_unique<FCoverageMap>();
+  return *coverage;
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::passChangesToOverlappingWindow (FTermArea* win, const FTermArea* area) const
+inline auto FVTerm::getCoverageWindow (FTermArea* area) const noexcept -> FCoverageWindow
 {
-  win->has_changes = true;
-  const int win_y_min = win->position.y;
-  const int y_start = calculateStartCoordinate (area->position.y, win_y_min);
-  const int area_height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
-  const int win_height = win->minimized ? win->min_size.height : getFullAreaHeight(win);
-  const int area_y_max = area->position.y + area_height - 1;
-  const int win_y_max = win_y_min + win_height - 1;
-  const int vterm_y_max = vterm->size.height - 1;
-  const int y_end = calculateEndCoordinate (vterm_y_max, area_y_max, win_y_min, win_y_max);
-
-  for (auto y{y_start}; y <= y_end; y++)  // Line loop
-  {
-    passChangesToOverlappingWindowLine (win, y, area);
-  }
+  const int height = area->minimized ? area->min_size.height
+                                     : getFullAreaHeight(area);
+  return { area
+         , area->position.x
+         , area->position.y
+         , area->position.x + getFullAreaWidth(area) - 1
+         , area->position.y + height - 1 };
 }
 
 //----------------------------------------------------------------------
-inline void FVTerm::passChangesToOverlappingWindowLine (FTermArea* win, int y, const FTermArea* area) const
+inline auto FVTerm::getCoverageIndex ( const FCoverageMap& coverage
+                                     , const FTermArea* area ) const noexcept -> int
 {
-  const int win_x_min = win->position.x;
-  const int x_start = calculateStartCoordinate (area->position.x, win_x_min);
-  const int area_x_max = area->position.x + area->size.width + area->shadow.width - 1;
-  const int win_x_max = win_x_min + win->size.width + win->shadow.width - 1;
-  const int vterm_x_max = vterm->size.width - 1;
-  const int x_end = calculateEndCoordinate (vterm_x_max, area_x_max, win_x_min, win_x_max);
+  // Returns the stacking position of the area in the coverage map,
+  // -1 for the virtual desktop or -2 for an unknown area
 
-  // Sets the new change boundaries
-  auto& line_changes = win->changes[unsigned(y)];
-  line_changes.xmin = uInt(std::min(int(line_changes.xmin), x_start));
-  line_changes.xmax = uInt(std::max(int(line_changes.xmax), x_end));
-}
+  if ( area == vdesktop.get() )
+    return -1;
 
-//----------------------------------------------------------------------
-inline int FVTerm::calculateStartCoordinate (int area_min, int win_min) const noexcept
-{
-  return std::max(0, std::max(area_min, win_min)) - win_min;
-}
+  const auto& windows = coverage.windows;
 
-//----------------------------------------------------------------------
-inline int FVTerm::calculateEndCoordinate (int vterm_max, int area_max, int win_min, int win_max) const noexcept
-{
-  return std::min(vterm_max, std::min(area_max, win_max)) - win_min;
+  for (std::size_t i{0}; i < windows.size(); i++)
+    if ( windows[i].area == area )
+      return int(i);
+
+  return -2;
 }
 
 //----------------------------------------------------------------------
-void FVTerm::restoreOverlaidWindows (const FTermArea* area) const noexcept
+auto FVTerm::updateCoverageMap() const -> const FCoverageMap&
 {
-  // Restoring overlaid windows
+  // The coverage map is rebuilt only if the window geometry,
+  // the stacking order or the terminal size has changed
 
-  const auto& win_list = getWindowList();
+  auto& coverage = getCoverageMap();
+  auto& windows = coverage.windows;
+  bool outdated = coverage.width != vterm->size.width
+               || coverage.height != vterm->size.height;
+  std::size_t count{0};
 
-  if ( ! win_list || win_list->empty() )
-    return;
+  const auto is_equal = [] (const FCoverageWindow& lhs, const FCoverageWindow& rhs)
+  {
+    return lhs.area == rhs.area
+        && lhs.x1 == rhs.x1 && lhs.y1 == rhs.y1
+        && lhs.x2 == rhs.x2 && lhs.y2 == rhs.y2;
+  };
 
-  bool overlaid{false};
+  static const FVTermList no_windows{};
+  const auto& win_list = window_list ? *window_list : no_windows;
 
-  for (auto&& win_obj : *win_list)
+  for (const auto& window : win_list)  // List from bottom to top
   {
-    const auto& win = win_obj->getVWin();
+    auto v_win = window->getVWin();
 
-    if ( overlaid && win && win->visible && win->isOverlapped(area) )
-      copyArea (vterm.get(), FPoint{win->position.x + 1, win->position.y + 1}, win);
-    else if ( getVWin() == win )
-      overlaid = true;
-  }
-}
+    if ( ! (v_win && v_win->visible && v_win->layer > 0) )
+      continue;
 
-//----------------------------------------------------------------------
-void FVTerm::updateVTerm() const
-{
-  // Updates the character data from all areas to VTerm
+    const auto win = getCoverageWindow(v_win);
 
-  if ( hasPendingUpdates(vdesktop.get()) )
+    if ( count == windows.size() )
+    {
+      windows.push_back(win);
+      outdated = true;
+    }
+    else if ( ! is_equal(windows[count], win) )
+    {
+      windows[count] = win;
+      outdated = true;
+    }
+
+    count++;
+  }
+
+  if ( count != windows.size() )
+  {
+    windows.resize(count);
+    outdated = true;
+  }
+
+  if ( outdated )
+    rebuildCoverageMap(coverage);
+
+  return coverage;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::rebuildCoverageMap (FCoverageMap& coverage) const
+{
+  // Determines the topmost window for each terminal cell
+  // and stores it as a list of column spans per row
+
+  coverage.width = vterm->size.width;
+  coverage.height = vterm->size.height;
+  coverage.rows.resize(std::size_t(std::max(coverage.height, 0)));
+
+  if ( coverage.width <= 0 )
+    return;
+
+  std::vector<int> owner(std::size_t(coverage.width));
+
+  for (auto y{0}; y < coverage.height; y++)  // Line loop
+  {
+    std::fill (owner.begin(), owner.end(), -1);
+
+    for (std::size_t i{0}; i < coverage.windows.size(); i++)
+    {
+      const auto& win = coverage.windows[i];
+      const int x1 = std::max(win.x1, 0);
+      const int x2 = std::min(win.x2, coverage.width - 1);
+
+      if ( y < win.y1 || y > win.y2 || x1 > x2 )
+        continue;
+
+      std::fill (owner.begin() + x1, owner.begin() + x2 + 1, int(i));
+    }
+
+    auto& spans = coverage.rows[std::size_t(y)];
+    spans.clear();
+
+    for (auto x{0}; x < coverage.width; x++)  // Column loop
+    {
+      const int index = owner[std::size_t(x)];
+
+      if ( spans.empty() || spans.back().index != index )
+        spans.push_back({x, x, index});
+      else
+        spans.back().x_end = x;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::addCoveredLayerLine ( const FCoverageMap& coverage
+                                 , int index, const FTermArea* area
+                                 , int ty, int x_start, int x_end
+                                 , bool has_transparency
+                                 , std::vector<bool>& overlap ) const noexcept
+{
+  // Writes only the visible characters of the terminal columns
+  // x_start to x_end. A character is hidden if the topmost window
+  // has a non-transparent character at this position.
+
+  for (const auto& span : coverage.rows[unsigned(ty)])
+  {
+    if ( span.x_end < x_start )
+      continue;
+
+    if ( span.x_start > x_end )
+      break;
+
+    const int span_start = std::max(span.x_start, x_start);
+    const int span_end = std::min(span.x_end, x_end);
+
+    if ( span.index <= index )  // Area is on top
+    {
+      addLayerRun (area, ty, span_start, span_end, has_transparency);
+      continue;
+    }
+
+    const auto& top = coverage.windows[std::size_t(span.index)];
+    const int top_y = ty - top.y1;
+    int run_start{-1};
+
+    for (auto x{span_start}; x <= span_end + 1; x++)  // Column loop
+    {
+      const bool visible = x <= span_end
+                        && isFCharTransparent(top.area->getFChar(x - top.x1, top_y));
+
+      if ( visible && run_start < 0 )
+      {
+        run_start = x;
+      }
+      else if ( ! visible && run_start >= 0 )
+      {
+        addLayerRun (area, ty, run_start, x - 1, has_transparency);
+        passChangesToOverlap (coverage, index, ty, run_start, x - 1, overlap);
+        run_start = -1;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::addLayerRun ( const FTermArea* area, int ty
+                                , int x_start, int x_end
+                                , bool has_transparency ) const noexcept
+{
+  // Writes the terminal columns x_start to x_end of the area to vterm
+
+  const auto& ac = area->getFChar ( x_start - area->position.x
+                                  , ty - area->position.y );  // Area character
+  auto& tc = vterm->getFChar(x_start, ty);  // Terminal character
+  const auto length = std::size_t(x_end - x_start + 1);
+
+  if ( has_transparency )
+    addAreaLineWithTransparency (&ac, &tc, length);
+  else
+    putAreaLine (ac, tc, length);
+
+  auto& vterm_changes = vterm->changes[unsigned(ty)];
+  vterm_changes.mark (uInt(x_start), uInt(x_end));
+}
+
+//----------------------------------------------------------------------
+void FVTerm::passChangesToOverlap ( const FCoverageMap& coverage
+                                  , int index, int ty
+                                  , int x_start, int x_end
+                                  , std::vector<bool>& overlap ) const noexcept
+{
+  // Marks the terminal columns x_start to x_end as changed in all
+  // windows above the given stacking position, so that their
+  // transparent characters are applied again. The changed windows
+  // are noted in overlap and queued later by markOverlappingWindows().
+
+  const auto& windows = coverage.windows;
+
+  for (auto i = std::size_t(index + 1); i < windows.size(); i++)
+  {
+    const auto& win = windows[i];
+
+    if ( ty < win.y1 || ty > win.y2 || x_end < win.x1 || x_start > win.x2 )
+      continue;
+
+    auto& line_changes = win.area->changes[unsigned(ty - win.y1)];
+    const auto xmin = uInt(std::max(x_start, win.x1) - win.x1);
+    const auto xmax = uInt(std::min(x_end, win.x2) - win.x1);
+    line_changes.mark (xmin, xmax);
+    overlap[i] = true;
+  }
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::markOverlappingWindows ( const FCoverageMap& coverage
+                                           , const std::vector<bool>& overlap ) const noexcept
+{
+  for (std::size_t i{0}; i < overlap.size(); i++)
+  {
+    if ( overlap[i] )
+      coverage.windows[i].area->has_changes = true;
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::restoreOverlaidWindows (const FTermArea* area) const noexcept
+{
+  // Restoring overlaid windows
+
+  if ( ! getVWin() )
+    return;
+
+  const auto& coverage = updateCoverageMap();
+  const int index = getCoverageIndex(coverage, getVWin());
+
+  if ( index < 0 )  // Window is not in the coverage map
+    return;
+
+  // Copy the overlapping windows above this window
+  for (auto i = std::size_t(index + 1); i < coverage.windows.size(); i++)
+  {
+    const auto win = coverage.windows[i].area;
+
+    if ( win->isOverlapped(area) )
+      copyArea (vterm.get(), FPoint{win->position.x + 1, win->position.y + 1}, win);
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::updateVTerm() const
+{
+  // Updates the character data from all areas to VTerm
+
+  if ( hasPendingUpdates(vdesktop.get()) && vdesktop->update_locks == 0 )
   {
     addLayer(vdesktop.get());  // Add vdesktop changes to vterm
     vdesktop->has_changes = false;
@@ -1396,26 +1951,136 @@ void FVTerm::updateVTerm() const
   if ( ! window_list || window_list->empty() )
     return;
 
-  for (auto&& window : *window_list)  // List from bottom to top
-  {
-    auto v_win = window->getVWin();
+  // Only windows from the dirty area list are processed. Windows are
+  // added from bottom to top so that changes passed to an overlapping
+  // window are handled in the same run.
+  auto inserts = dirty_area_inserts;
+  auto dirty_windows = getDirtyWindows(-1);
+  std::size_t n{0};
 
-    if ( ! (v_win && v_win->visible && v_win->layer > 0) )
-      continue;
+  while ( n < dirty_windows.size() )
+  {
+    const int index = dirty_windows[n];
+    n++;
+    const auto& coverage = getCoverageMap();
+    auto v_win = coverage.windows[std::size_t(index)].area;
 
     if ( hasPendingUpdates(v_win) )
     {
-      passChangesToOverlap(v_win);
       addLayer(v_win);  // Add v_win changes to vterm
       v_win->has_changes = false;
     }
-    else if ( hasChildAreaChanges(v_win) )
+    else
     {
-      passChangesToOverlap(v_win);
       addLayer(v_win);  // and call the child area processing handler there
       clearChildAreaChanges(v_win);
     }
+
+    if ( ! v_win->has_changes )
+      dequeueDirtyArea(v_win);
+
+    if ( inserts != dirty_area_inserts )
+    {
+      // Areas were queued while processing, e.g. overlapping windows
+      inserts = dirty_area_inserts;
+      dirty_windows = getDirtyWindows(index);
+      n = 0;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getDirtyWindows (int index) const -> std::vector<int>
+{
+  // Returns the ascending stacking positions above index of all
+  // windows with changes in their area or in one of their child areas
+
+  const auto& coverage = updateCoverageMap();
+  std::vector<int> positions{};
+  auto area = dirty_areas;
+
+  while ( area )
+  {
+    auto next_area = area->dirty_next;
+
+    if ( ! area->has_changes || area == vterm.get()
+      || area == vterm_old.get() || area == vdesktop.get() )
+    {
+      dequeueDirtyArea(area);  // Nothing to do for a window
+      area = next_area;
+      continue;
+    }
+
+    int pos = getCoverageIndex(coverage, area);
+
+    if ( pos < 0 && area->preproc_owner )  // Child print area
+      pos = getCoverageIndex(coverage, area->preproc_owner);
+    else if ( pos < 0 && ! isWindowArea(area) )
+    {
+      dequeueDirtyArea(area);  // No window processes this area
+      area = next_area;
+      continue;
+    }
+
+    if ( pos > index
+      && coverage.windows[std::size_t(pos)].area->update_locks == 0 )
+      positions.push_back(pos);  // Locked by beginUpdate() otherwise
+
+    area = next_area;
   }
+
+  std::sort (positions.begin(), positions.end());
+  positions.erase ( std::unique(positions.begin(), positions.end())
+                  , positions.end() );
+  return positions;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::isWindowArea (const FTermArea* area) const noexcept -> bool
+{
+  // Is the area the virtual window of a (possibly hidden) window?
+
+  return area->hasOwner() && area->getOwner<FVTerm*>()->vwin.get() == area;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::queueDirtyArea (FTermArea* area) noexcept
+{
+  // Inserts the area at the head of the dirty area list
+
+  if ( ! area || area->dirty_queued )
+    return;
+
+  area->dirty_prev = nullptr;
+  area->dirty_next = dirty_areas;
+
+  if ( dirty_areas )
+    dirty_areas->dirty_prev = area;
+
+  dirty_areas = area;
+  area->dirty_queued = true;
+  dirty_area_inserts++;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::dequeueDirtyArea (FTermArea* area) noexcept
+{
+  // Removes the area from the dirty area list
+
+  if ( ! area || ! area->dirty_queued )
+    return;
+
+  if ( area->dirty_prev )
+    area->dirty_prev->dirty_next = area->dirty_next;
+  else
+    dirty_areas = area->dirty_next;
+
+  if ( area->dirty_next )
+    area->dirty_next->dirty_prev = area->dirty_prev;
+
+  area->dirty_prev = nullptr;
+  area->dirty_next = nullptr;
+  area->dirty_queued = false;
 }
 
 //----------------------------------------------------------------------
@@ -1434,8 +2099,7 @@ inline void FVTerm::scrollTerminalForward() const
   for (auto y{0}; y < y_max; y++)
   {
     auto& vdesktop_changes = vdesktop->changes[unsigned(y)];
-    vdesktop_changes.xmin = uInt(vdesktop->size.width - 1);
-    vdesktop_changes.xmax = 0;
+    vdesktop_changes.reset (uInt(vdesktop->size.width));
   }
 
   putArea (FPoint{1, 1}, vdesktop.get());
@@ -1459,8 +2123,7 @@ inline void FVTerm::scrollTerminalReverse() const
   for (auto y{0}; y < y_max; y++)
   {
     auto& vdesktop_changes = vdesktop->changes[unsigned(y + 1)];
-    vdesktop_changes.xmin = uInt(vdesktop->size.width - 1);
-    vdesktop_changes.xmax = 0;
+    vdesktop_changes.reset (uInt(vdesktop->size.width));
   }
 
   putArea (FPoint{1, 1}, vdesktop.get());
@@ -1468,6 +2131,183 @@ inline void FVTerm::scrollTerminalReverse() const
   forceTerminalUpdate();
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::getTerminalScrollRegion (const FTermArea* area) const -> FRect
+{
+  // Returns the visible terminal region of a window area
+  // in 0-based terminal coordinates
+
+  if ( ! area )
+    return {};
+
+  const FRect box { area->position.x, area->position.y
+                  , std::size_t(area->size.width)
+                  , std::size_t(area->size.height) };
+  return getTerminalScrollRegion (area, box);
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getTerminalScrollRegion ( const FTermArea* area
+                                     , const FRect& box ) const -> FRect
+{
+  // Returns the part of the box (0-based terminal coordinates)
+  // that lies in the visible terminal region of a window area
+
+  if ( ! area || ! area->visible || area->minimized
+    || box.isEmpty() || ! isWindowArea(area) )
+    return {};
+
+  const int x1 = std::max({box.getX1(), area->position.x, 0});
+  const int y1 = std::max({box.getY1(), area->position.y, 0});
+  const int x2 = std::min({ box.getX2()
+                          , area->position.x + area->size.width - 1
+                          , vterm->size.width - 1 });
+  const int y2 = std::min({ box.getY2()
+                          , area->position.y + area->size.height - 1
+                          , vterm->size.height - 1 });
+
+  if ( x1 > x2 || y1 >= y2 )
+    return {};
+
+  const FRect region{FPoint{x1, y1}, FPoint{x2, y2}};
+
+  // A higher window over the region would be scrolled with it
+  // on the terminal, so the region is redrawn instead
+  if ( isRegionCovered(area, region) )
+    return {};
+
+  return region;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::isRegionCovered ( const FTermArea* area
+                             , const FRect& region ) const -> bool
+{
+  // Is a part of the terminal region (0-based terminal coordinates)
+  // covered by a window above the area?
+
+  const auto& coverage = updateCoverageMap();
+  const int index = getCoverageIndex(coverage, area);
+
+  if ( index < -1 )  // Area is not in the coverage map
+    return true;
+
+  for (auto y{region.getY1()}; y <= region.getY2(); y++)  // Line loop
+  {
+    for (const auto& span : coverage.rows[unsigned(y)])
+    {
+      if ( span.x_end < region.getX1() )
+        continue;
+
+      if ( span.x_start > region.getX2() )
+        break;
+
+      if ( span.index > index )
+        return true;
+    }
+  }
+
+  return false;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::scrollPrintRegionForward (const FRect& box)
+{
+  // Scrolls the terminal lines of a print area box (1-based terminal
+  // coordinates) up one line. The caller then prints the scrolled
+  // content, and only the new bottom line is sent to the terminal.
+
+  const FRect region{box.getX() - 1, box.getY() - 1, box.getWidth(), box.getHeight()};
+  scrollTerminalRegionForward (getTerminalScrollRegion(getPrintArea(), region));
+}
+
+//----------------------------------------------------------------------
+void FVTerm::scrollPrintRegionReverse (const FRect& box)
+{
+  // Scrolls the terminal lines of a print area box (1-based terminal
+  // coordinates) down one line. The caller then prints the scrolled
+  // content, and only the new top line is sent to the terminal.
+
+  const FRect region{box.getX() - 1, box.getY() - 1, box.getWidth(), box.getHeight()};
+  scrollTerminalRegionReverse (getTerminalScrollRegion(getPrintArea(), region));
+}
+
+//----------------------------------------------------------------------
+void FVTerm::scrollTerminalRegionForward (const FRect& region) const
+{
+  // Scrolls a terminal region up one line,
+  // so that only the newly exposed line has to be printed
+
+  if ( region.isEmpty() || ! foutput->scrollTerminalRegionForward(region) )
+    return;
+
+  // Move the known terminal content up within the region
+  const int x1 = region.getX1();
+  const int y2 = region.getY2();
+  const auto width = region.getWidth();
+
+  for (auto y{region.getY1()}; y < y2; y++)
+    putAreaLine (vterm_old->getFChar(x1, y + 1), vterm_old->getFChar(x1, y), width);
+
+  invalidateTerminalLine (x1, y2, width);
+  markTerminalRegionAsChanged (region);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::scrollTerminalRegionReverse (const FRect& region) const
+{
+  // Scrolls a terminal region down one line,
+  // so that only the newly exposed line has to be printed
+
+  if ( region.isEmpty() || ! foutput->scrollTerminalRegionReverse(region) )
+    return;
+
+  // Move the known terminal content down within the region
+  const int x1 = region.getX1();
+  const int y1 = region.getY1();
+  const auto width = region.getWidth();
+
+  for (auto y{region.getY2()}; y > y1; y--)
+    putAreaLine (vterm_old->getFChar(x1, y - 1), vterm_old->getFChar(x1, y), width);
+
+  invalidateTerminalLine (x1, y1, width);
+  markTerminalRegionAsChanged (region);
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::invalidateTerminalLine ( int x, int y
+                                           , std::size_t width ) const
+{
+  // The content of a scrolled-in terminal line is unknown
+
+  auto* first = &vterm_old->getFChar(x, y);
+
+  std::for_each ( first, first + width
+                , [] (auto& fchar)
+                  {
+                    fchar.fg_color = FColor::Undefined;
+                    fchar.bg_color = FColor::Undefined;
+                  }
+                );
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::markTerminalRegionAsChanged (const FRect& region) const
+{
+  // Compare the whole region with the scrolled terminal content
+
+  const auto x1 = uInt(region.getX1());
+  const auto x2 = uInt(region.getX2());
+
+  for (auto y{region.getY1()}; y <= region.getY2(); y++)
+  {
+    auto& vterm_changes = vterm->changes[unsigned(y)];
+    vterm_changes.mark (x1, x2);
+  }
+
+  vterm->has_changes = true;
+}
+
 //----------------------------------------------------------------------
 void FVTerm::callPreprocessingHandler (const FTermArea* area) const
 {
@@ -1656,8 +2496,74 @@ inline void FVTerm::putAreaLineWithTransparency ( const FChar* src_char
 inline void FVTerm::putTransparentAreaLine ( const FPoint& pos
                                            , const std::size_t length ) const
 {
-  FRect box(pos.getX() + 1 - int(length), pos.getY() + 1, length, 1);
-  restoreVTerm(box);
+  // Resolves the transparent characters left of pos
+  // directly from the window stack of this terminal row
+
+  const int x_end = pos.getX() - 1;
+  const int x_start = x_end + 1 - int(length);
+  composeLayerStack (pos.getY(), std::max(0, x_start), x_end);
+}
+
+//----------------------------------------------------------------------
+void FVTerm::composeLayerStack (int ty, int x_start, int x_end) const noexcept
+{
+  // Composes the terminal columns x_start to x_end in a single pass
+  // over the layers of row ty. For each column, the composition
+  // starts at the topmost layer with a non-transparent character.
+
+  if ( ! vterm || ty < 0 || ty >= vterm->size.height )
+    return;
+
+  x_end = std::min(x_end, vterm->size.width - 1);
+
+  if ( x_start > x_end )
+    return;
+
+  const auto& coverage = updateCoverageMap();
+  const auto& windows = coverage.windows;
+  const auto& spans = coverage.rows[unsigned(ty)];
+  auto span = spans.cbegin();
+
+  const auto covers = [ty] (const FCoverageWindow& win, int x)
+  {
+    return x >= win.x1 && x <= win.x2 && ty >= win.y1 && ty <= win.y2;
+  };
+
+  for (auto x{x_start}; x <= x_end; x++)  // Column loop
+  {
+    while ( span != spans.cend() && span->x_end < x )
+      ++span;
+
+    const int top = ( span != spans.cend() ) ? span->index : -1;
+    int base = top;
+
+    while ( base >= 0 )  // Search the topmost opaque layer
+    {
+      const auto& win = windows[std::size_t(base)];
+
+      if ( covers(win, x)
+        && ! isFCharTransparent(win.area->getFChar(x - win.x1, ty - win.y1)) )
+        break;
+
+      base--;
+    }
+
+    auto& tc = vterm->getFChar(x, ty);  // Terminal character
+
+    if ( base < 0 && vdesktop
+      && x < vdesktop->size.width && ty < vdesktop->size.height )
+      addTransparentAreaChar (vdesktop->getFChar(x, ty), tc);
+
+    for (auto i{std::max(base, 0)}; i <= top; i++)  // Layer loop
+    {
+      const auto& win = windows[std::size_t(i)];
+
+      if ( covers(win, x) )
+        addTransparentAreaChar (win.area->getFChar(x - win.x1, ty - win.y1), tc);
+    }
+  }
+
+  vterm->changes[unsigned(ty)].mark (uInt(x_start), uInt(x_end));
 }
 
 //----------------------------------------------------------------------
@@ -1778,8 +2684,7 @@ auto FVTerm::clearFullArea (FTermArea* area, FChar& fillchar) const -> bool
     for (auto i{0}; i < vdesktop->size.height; i++)
     {
       auto& vdesktop_changes = vdesktop->changes[unsigned(i)];
-      vdesktop_changes.xmin = 0;
-      vdesktop_changes.xmax = uInt(vdesktop->size.width) - 1;
+      vdesktop_changes.set (0, uInt(vdesktop->size.width) - 1);
       vdesktop_changes.trans_count = 0;
     }
 
@@ -1908,15 +2813,77 @@ inline auto FVTerm::printCharacterOnCoordinate ( FTermArea* area
 
   const auto padding = unsigned(ac->attr.bit.char_width == 2);
 
-  if ( uInt(ax) < line_changes.xmin )
-    line_changes.xmin = uInt(ax);
-
-  if ( uInt(ax) + padding > line_changes.xmax )
-    line_changes.xmax = uInt(ax) + padding;
+  line_changes.mark (uInt(ax), uInt(ax) + padding);
 
   return ac->attr.bit.char_width;
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::printRun ( FTermArea* area
+                      , const FVTermBuffer& buffer ) const noexcept -> bool
+{
+  // Copies a run of single-column characters without control codes
+  // directly into the current line of the area. Returns false if
+  // the run requires character-by-character printing.
+
+  const auto length = int(buffer.getLength());
+  const int ax = area->cursor.x - 1;
+  const int ay = area->cursor.y - 1;
+
+  if ( ! area->checkPrintPos() || ax + length > getFullAreaWidth(area) )
+    return false;
+
+  auto* ac = &area->getFChar(ax, ay);  // area character
+
+  for (auto i{0}; i < length; i++)
+  {
+    const auto& ch = buffer[std::size_t(i)];
+
+    if ( ch.attr.bit.char_width != 1
+      || std::iswcntrl(wint_t(ch.ch[0]))
+      || (ch.attr.byte[1] & b1_print_trans_mask) != 0
+      || (ac[i].attr.byte[1] & b1_print_trans_mask) != 0 )
+      return false;
+  }
+
+  int first{-1};
+  int last{-1};
+
+  for (auto i{0}; i < length; i++)
+  {
+    const auto& ch = buffer[std::size_t(i)];
+
+    if ( ac[i] == ch )
+      continue;
+
+    ac[i] = ch;
+
+    if ( first < 0 )
+      first = i;
+
+    last = i;
+  }
+
+  if ( first >= 0 )
+    area->changes[unsigned(ay)].mark (uInt(ax + first), uInt(ax + last));
+
+  area->has_changes = true;
+  area->cursor.x += length;
+
+  // Line break at right margin
+  if ( area->cursor.x > getFullAreaWidth(area) )
+  {
+    area->cursor.x = 1;
+    area->cursor.y++;
+  }
+
+  // Prevent up scrolling
+  if ( area->cursor.y > getFullAreaHeight(area) )
+    area->cursor.y--;
+
+  return true;
+}
+
 //----------------------------------------------------------------------
 inline void FVTerm::printPaddingCharacter (FTermArea* area, const FChar& term_char) const
 {
@@ -2009,4 +2976,71 @@ auto FVTerm::hasPendingUpdates (const FTermArea* area) noexcept -> bool
   return (area && area->has_changes);
 }
 
+
+
+//----------------------------------------------------------------------
+// struct FVTerm::FLineChanges
+//----------------------------------------------------------------------
+
+// private methods of FVTerm::FLineChanges
+//----------------------------------------------------------------------
+void FVTerm::FLineChanges::insertSpan (uInt x1, uInt x2) noexcept
+{
+  // Inserts the interval x1 to x2 into the sorted span list.
+  // Overlapping and adjacent spans are joined. If there is no free
+  // slot left, the two neighboring spans with the smallest gap
+  // between them are combined.
+
+  if ( x1 > x2 )
+    return;
+
+  std::array<FSpan, MAX_SPANS + 1> list{};
+  std::size_t count{0};
+  std::size_t i{0};
+
+  while ( i < span_count && spans[i].xmax + 1 < x1 )  // Spans on the left
+  {
+    list[count] = spans[i];
+    count++;
+    i++;
+  }
+
+  while ( i < span_count && spans[i].xmin <= x2 + 1 )  // Touching spans
+  {
+    x1 = std::min(x1, spans[i].xmin);
+    x2 = std::max(x2, spans[i].xmax);
+    i++;
+  }
+
+  list[count] = {x1, x2};
+  count++;
+
+  while ( i < span_count )  // Spans on the right
+  {
+    list[count] = spans[i];
+    count++;
+    i++;
+  }
+
+  if ( count > MAX_SPANS )
+  {
+    std::size_t join{0};
+
+    for (std::size_t n{1}; n + 1 < count; n++)
+    {
+      if ( list[n + 1].xmin - list[n].xmax < list[join + 1].xmin - list[join].xmax )
+        join = n;
+    }
+
+    list[join].xmax = list[join + 1].xmax;
+    std::copy (&list[join + 2], &list[count], &list[join + 1]);
+    count--;
+  }
+
+  std::copy (&list[0], &list[count], spans.begin());
+  span_count = uInt(count);
+  xmin = spans[0].xmin;
+  xmax = spans[count - 1].xmax;
+}
+
 }  // namespace finalcut
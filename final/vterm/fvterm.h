@@ -50,6 +50,7 @@
 #include <sys/time.h>  // need for timeval (cygwin)
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -96,16 +97,10 @@ struct outputClass
 class FVTerm : public FVTermAttribute
 {
   public:
+    struct FLineChanges;          // forward declaration
     struct FTermArea;             // forward declaration
     struct FVTermPreprocessing;   // forward declaration
 
-    struct FLineChanges
-    {
-      uInt xmin;           // X-position with the first change
-      uInt xmax;           // X-position with the last change
-      uInt trans_count;    // Number of transparent characters
-    };
-
     // Using-declarations
     using FVTermAttribute::print;
     using FCharVector = std::vector<FChar>;
@@ -173,6 +168,8 @@ class FVTerm : public FVTermAttribute
     auto  getVWin() const noexcept -> const FTermArea*;
     auto  getPrintCursor() -> FPoint;
     static auto  getWindowList() -> FVTermList*;
+    static auto  getCompositingThreads() -> std::size_t;
+    static auto  getTargetFrameRate() -> uInt;
 
     // Mutators
     void  setTerminalUpdates (TerminalUpdate) const;
@@ -180,6 +177,8 @@ class FVTerm : public FVTermAttribute
     void  setVWin (std::unique_ptr<FTermArea>&&) noexcept;
     static void  setNonBlockingRead (bool = true);
     static void  unsetNonBlockingRead();
+    static void  setCompositingThreads (std::size_t);
+    static void  setTargetFrameRate (uInt);
 
     // Inquiries
     static auto  isDrawingFinished() noexcept -> bool;
@@ -195,6 +194,8 @@ class FVTerm : public FVTermAttribute
     void  resizeVTerm (const FSize&) const noexcept;
     void  putVTerm() const;
     auto  updateTerminal() const -> bool;
+    virtual void beginUpdate();
+    virtual void endUpdate();
     static void reduceTerminalLineUpdates (uInt);
     virtual void addPreprocessingHandler ( const FVTerm*
                                          , FPreprocessingFunction&& );
@@ -262,6 +263,8 @@ class FVTerm : public FVTermAttribute
     static void  determineWindowLayers() noexcept;
     void  scrollAreaForward (FTermArea*);
     void  scrollAreaReverse (FTermArea*);
+    void  scrollPrintRegionForward (const FRect&);
+    void  scrollPrintRegionReverse (const FRect&);
     void  clearArea (FTermArea*, wchar_t = L' ') noexcept;
     void  forceTerminalUpdate() const;
     auto  processTerminalUpdate() const -> bool;
@@ -272,6 +275,7 @@ class FVTerm : public FVTermAttribute
   private:
     // Constants
     static constexpr int DEFAULT_MINIMIZED_HEIGHT = 1;
+    static constexpr int MIN_BAND_HEIGHT = 8;  // Lines per compositing band
 
     // Enumeration
     enum class CoveredState
@@ -281,10 +285,41 @@ class FVTerm : public FVTermAttribute
       Full
     };
 
+    struct FCoverageWindow
+    {
+      FTermArea* area;     // Virtual window
+      int        x1;       // Terminal columns and rows
+      int        y1;       // of the window including
+      int        x2;       // the shadow
+      int        y2;
+    };
+
+    struct FCoverageSpan
+    {
+      int x_start;         // First terminal column of the span
+      int x_end;           // Last terminal column of the span
+      int index;           // Topmost window (-1 = virtual desktop)
+    };
+
+    struct FCoverageMap
+    {
+      // Using-declaration
+      using FSpanList = std::vector<FCoverageSpan>;
+
+      // Data members
+      int                          width{-1};   // Virtual terminal size
+      int                          height{-1};
+      std::vector<FCoverageWindow> windows{};   // From bottom to top
+      std::vector<FSpanList>       rows{};      // Spans per terminal row
+    };
+
     // Methods
     static void setGlobalFVTermInstance (FVTerm* ptr);
     static auto getGlobalFVTermInstance() -> FVTerm*&;
     static auto isInitialized() -> bool;
+    static auto reduceTerminalSpanUpdates (uInt&, uInt&, uInt) -> bool;
+    static void queueDirtyArea (FTermArea*) noexcept;
+    static void dequeueDirtyArea (FTermArea*) noexcept;
     void  resetAreaEncoding() const;
     void  resetTextAreaToDefault (FTermArea*, const FSize&) const noexcept;
     auto  resizeTextArea (FTermArea*, std::size_t, std::size_t ) const -> bool;
@@ -298,15 +333,34 @@ class FVTerm : public FVTermAttribute
     void  updateAreaProperties (FTermArea*, const FShadowBox&) const;
     constexpr auto  getFullAreaWidth (const FTermArea*) const noexcept -> int;
     constexpr auto  getFullAreaHeight (const FTermArea*) const noexcept -> int;
-    void  passChangesToOverlap (const FTermArea*) const;
-    void  passChangesToOverlappingWindow (FTermArea*, const FTermArea*) const;
-    void  passChangesToOverlappingWindowLine (FTermArea*, int, const FTermArea*) const;
-    int   calculateStartCoordinate (int, int) const noexcept;
-    int   calculateEndCoordinate (int, int, int, int) const noexcept;
+    static auto getCoverageMap() -> FCoverageMap&;
+    auto  getCoverageWindow (FTermArea*) const noexcept -> FCoverageWindow;
+    auto  getCoverageIndex (const FCoverageMap&, const FTermArea*) const noexcept -> int;
+    auto  updateCoverageMap() const -> const FCoverageMap&;
+    void  rebuildCoverageMap (FCoverageMap&) const;
+    void  addLayerLines ( const FCoverageMap&, int, FTermArea*
+                        , int, int, std::vector<bool>& ) const noexcept;
+    void  addCoveredLayerLine ( const FCoverageMap&, int, const FTermArea*
+                              , int, int, int, bool
+                              , std::vector<bool>& ) const noexcept;
+    void  addLayerRun (const FTermArea*, int, int, int, bool) const noexcept;
+    void  passChangesToOverlap ( const FCoverageMap&, int, int, int, int
+                               , std::vector<bool>& ) const noexcept;
+    void  markOverlappingWindows ( const FCoverageMap&
+                                 , const std::vector<bool>& ) const noexcept;
     void  restoreOverlaidWindows (const FTermArea* area) const noexcept;
     void  updateVTerm() const;
+    auto  getDirtyWindows (int) const -> std::vector<int>;
+    auto  isWindowArea (const FTermArea*) const noexcept -> bool;
     void  scrollTerminalForward() const;
     void  scrollTerminalReverse() const;
+    auto  getTerminalScrollRegion (const FTermArea*) const -> FRect;
+    auto  getTerminalScrollRegion (const FTermArea*, const FRect&) const -> FRect;
+    auto  isRegionCovered (const FTermArea*, const FRect&) const -> bool;
+    void  scrollTerminalRegionForward (const FRect&) const;
+    void  scrollTerminalRegionReverse (const FRect&) const;
+    void  invalidateTerminalLine (int, int, std::size_t) const;
+    void  markTerminalRegionAsChanged (const FRect&) const;
     void  callPreprocessingHandler (const FTermArea*) const;
     auto  hasChildAreaChanges (const FTermArea*) const -> bool;
     void  clearChildAreaChanges (const FTermArea*) const;
@@ -322,6 +376,7 @@ class FVTerm : public FVTermAttribute
     void  putAreaLine (const FChar&, FChar&, const std::size_t) const;
     void  putAreaLineWithTransparency (const FChar*, FChar*, const int, FPoint) const;
     void  putTransparentAreaLine (const FPoint&, const std::size_t) const;
+    void  composeLayerStack (int, int, int) const noexcept;
     void  addAreaLineWithTransparency (const FChar*, FChar*, const std::size_t) const;
     void  addTransparentAreaLine (const FChar&, FChar&, const std::size_t) const;
     void  addTransparentAreaChar (const FChar&, FChar&) const;
@@ -333,6 +388,7 @@ class FVTerm : public FVTermAttribute
     auto  changedFromTransparency (const FChar&, const FChar&) const -> bool;
     auto  printCharacterOnCoordinate ( FTermArea*
                                      , const FChar&) const noexcept -> std::size_t;
+    auto  printRun (FTermArea*, const FVTermBuffer&) const noexcept -> bool;
     void  printPaddingCharacter (FTermArea*, const FChar&) const;
     void  putNonTransparent (std::size_t&, const FChar*, FChar*&) const;
     void  addTransparent (std::size_t&, const FChar*, FChar*&) const;
@@ -344,6 +400,7 @@ class FVTerm : public FVTermAttribute
     // Data members
     FTermArea*                   print_area{nullptr};        // Print area for this object
     FTermArea*                   child_print_area{nullptr};  // Print area for children
+    FTermArea*                   update_area{nullptr};       // Area held back by beginUpdate()
     FVTermBuffer                 vterm_buffer{};             // Print buffer
     FChar                        nc{};                       // next character
     std::unique_ptr<FTermArea>   vwin{};                     // Virtual window
@@ -359,6 +416,9 @@ class FVTerm : public FVTermAttribute
     static bool                  skip_one_vterm_update;
     static bool                  no_terminal_updates;
     static bool                  force_terminal_update;
+    static bool                  deferred_vterm_update;      // Frame not yet due
+    static FTermArea*            dirty_areas;                // Areas with changes
+    static uInt64                dirty_area_inserts;         // Dirty list insertions
 
     // Friend function
     friend void setPrintArea (FWidget&, FTermArea*);
@@ -366,12 +426,135 @@ class FVTerm : public FVTermAttribute
 };
 
 
+//----------------------------------------------------------------------
+// struct FVTerm::FLineChanges
+//----------------------------------------------------------------------
+
+struct FVTerm::FLineChanges  // Changed columns of an area line
+{
+  struct FSpan
+  {
+    uInt xmin;  // First changed column
+    uInt xmax;  // Last changed column
+  };
+
+  static constexpr std::size_t MAX_SPANS{4};
+
+  // Accessors
+  auto getXmin() const noexcept -> uInt;
+  auto getXmax() const noexcept -> uInt;
+  auto getSpanCount() const noexcept -> std::size_t;
+  auto getSpan (std::size_t) const noexcept -> FSpan;
+
+  // Inquiry
+  auto hasChanges() const noexcept -> bool;
+
+  // Methods
+  void mark (uInt, uInt) noexcept;
+  void set (uInt, uInt) noexcept;
+  void reset (uInt) noexcept;
+
+  // Data member
+  uInt trans_count{0};  // Number of transparent characters
+
+  private:
+    // Method
+    void insertSpan (uInt, uInt) noexcept;
+
+    // Data members
+    uInt xmin{1};         // X-position with the first change
+    uInt xmax{0};         // X-position with the last change
+    uInt span_count{0};   // Number of used entries in spans
+    std::array<FSpan, MAX_SPANS> spans{};  // Sorted, disjoint changed intervals
+};
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getXmin() const noexcept -> uInt
+{
+  return xmin;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getXmax() const noexcept -> uInt
+{
+  return xmax;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getSpanCount() const noexcept -> std::size_t
+{
+  return std::size_t(span_count);
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::getSpan (std::size_t index) const noexcept -> FSpan
+{
+  return spans[index];
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FLineChanges::hasChanges() const noexcept -> bool
+{
+  return span_count > 0;
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::FLineChanges::mark (uInt x1, uInt x2) noexcept
+{
+  // Marks the columns x1 to x2 as changed
+
+  if ( span_count > 0 )
+  {
+    auto& last = spans[span_count - 1];
+
+    if ( x1 >= last.xmin && x1 <= last.xmax + 1 )
+    {
+      // Fast path for sequential printing
+      last.xmax = std::max(last.xmax, x2);
+      xmax = last.xmax;
+      return;
+    }
+  }
+
+  insertSpan (x1, x2);
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::FLineChanges::set (uInt x1, uInt x2) noexcept
+{
+  // Replaces all changes with the columns x1 to x2
+
+  if ( x1 > x2 )
+  {
+    reset (x1);
+    return;
+  }
+
+  xmin = x1;
+  xmax = x2;
+  spans[0] = {x1, x2};
+  span_count = 1;
+}
+
+//----------------------------------------------------------------------
+inline void FVTerm::FLineChanges::reset (uInt width) noexcept
+{
+  // Removes all changes from a line with the given width
+
+  xmin = width;
+  xmax = 0;
+  span_count = 0;
+}
+
+
 //----------------------------------------------------------------------
 // struct FVTerm::FTermArea
 //----------------------------------------------------------------------
 
 struct FVTerm::FTermArea  // Define virtual terminal character properties
 {
+  class FChangeFlag;  // forward declaration
+
   // Using-declaration
   using FDataAccessPtr  = std::shared_ptr<FDataAccess>;
   using FLineChangesPtr = std::vector<FLineChanges>;
@@ -384,7 +567,7 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
   FTermArea (const FTermArea&) = delete;
 
   // Destructor
-  ~FTermArea() = default;
+  ~FTermArea() noexcept;
 
   // Disable copy assignment operator (=)
   auto operator = (const FTermArea&) -> FTermArea& = delete;
@@ -466,6 +649,30 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
     int height{};
   };
 
+  class FChangeFlag  // Queues the area in the dirty area list when set
+  {
+    public:
+      // Constructor
+      explicit FChangeFlag (FTermArea* area) noexcept
+        : owner_area{area}
+      { }
+
+      // Disable copy constructor
+      FChangeFlag (const FChangeFlag&) = delete;
+
+      // Disable copy assignment operator (=)
+      auto operator = (const FChangeFlag&) -> FChangeFlag& = delete;
+
+      // Overloaded operators
+      auto operator = (bool) noexcept -> FChangeFlag&;
+      operator bool() const noexcept;
+
+    private:
+      // Data members
+      FTermArea* owner_area{nullptr};
+      bool       value{false};
+  };
+
   Coordinate      position{0, 0};        // Distance from left and top of terminal edge
   Dimension       size{-1, -1};          // Window width and height
   Dimension       shadow{0, 0};          // Right and bottom window shadow
@@ -473,17 +680,45 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
   Coordinate      cursor{0, 0};          // Position for the next write operation
   Coordinate      input_cursor{-1, -1};  // Position of visible input cursor
   int             layer{-1};
+  uInt            update_locks{0};       // Nested beginUpdate() calls
   Encoding        encoding{Encoding::Unknown};
   bool            input_cursor_visible{false};
-  bool            has_changes{false};
+  FChangeFlag     has_changes{this};
   bool            visible{false};
   bool            minimized{false};
+  bool            dirty_queued{false};   // Area is in the dirty area list
+  FTermArea*      dirty_prev{nullptr};   // Links of the dirty area list
+  FTermArea*      dirty_next{nullptr};
+  FTermArea*      preproc_owner{nullptr};  // Window with the handler of this child area
   FDataAccessPtr  owner{nullptr};        // Object that owns this FTermArea
   FPreprocVector  preproc_list{};
   FLineChangesPtr changes{};
   FCharPtr        data{};                // FChar data of the drawing area
 };
 
+//----------------------------------------------------------------------
+inline FVTerm::FTermArea::~FTermArea() noexcept  // destructor
+{
+  FVTerm::dequeueDirtyArea(this);
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::FTermArea::FChangeFlag::operator = (bool flag) noexcept -> FChangeFlag&
+{
+  value = flag;
+
+  if ( flag )
+    FVTerm::queueDirtyArea(owner_area);
+
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FVTerm::FTermArea::FChangeFlag::operator bool() const noexcept
+{
+  return value;
+}
+
 //----------------------------------------------------------------------
 inline auto FVTerm::FTermArea::contains (const FPoint& pos) const noexcept -> bool
 {
@@ -571,8 +806,7 @@ inline auto FVTerm::FTermArea::reprint (const FRect& box, const FSize& term_size
     const int x2 = position.x + size.width + shadow.width - 1;
     const int x_end = std::min(int(term_size.getWidth()) - 1 , std::min(box_x2, x2)) - position.x;
     auto& line_changes = changes[std::size_t(y)];
-    line_changes.xmin = uInt(std::min(int(line_changes.xmin), x_start));
-    line_changes.xmax = uInt(std::max(int(line_changes.xmax), x_end));
+    line_changes.mark (uInt(x_start), uInt(x_end));
   }
 
   return true;
@@ -762,7 +996,10 @@ inline auto FVTerm::areTerminalUpdatesPaused() noexcept -> bool
 
 //----------------------------------------------------------------------
 inline auto FVTerm::hasPendingTerminalUpdates() noexcept -> bool
-{ return hasPendingUpdates(getGlobalFVTermInstance()->vterm.get()); }
+{
+  return deferred_vterm_update
+      || hasPendingUpdates(getGlobalFVTermInstance()->vterm.get());
+}
 
 //----------------------------------------------------------------------
 template <typename... Args>
@@ -803,10 +1040,6 @@ inline auto FVTerm::getVirtualTerminal() const -> FTermArea*
 inline void FVTerm::setPrintArea (FTermArea* area)
 { print_area = area; }
 
-//----------------------------------------------------------------------
-inline void FVTerm::setChildPrintArea (FTermArea* area)
-{ child_print_area = area; }
-
 //----------------------------------------------------------------------
 inline void FVTerm::setActiveArea (FTermArea* area) const
 { active_area = area; }
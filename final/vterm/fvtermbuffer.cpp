@@ -21,7 +21,11 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <list>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "final/fc.h"
@@ -37,6 +41,106 @@
 namespace finalcut
 {
 
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// class GlyphRunCache
+//----------------------------------------------------------------------
+
+class GlyphRunCache
+{
+  public:
+    // Using-declaration
+    using FCharVector = FVTermBuffer::FCharVector;
+
+    struct Key
+    {
+      const FString* string{nullptr};  // Not owned, see Entry
+      uInt64         colors{0};        // Foreground and background color
+      uInt32         style{0};         // Attributes and encoding
+
+      friend auto operator == (const Key& lhs, const Key& rhs) -> bool
+      {
+        return lhs.colors == rhs.colors
+            && lhs.style == rhs.style
+            && *lhs.string == *rhs.string;
+      }
+    };
+
+    struct KeyHash
+    {
+      auto operator () (const Key& key) const noexcept -> std::size_t
+      {
+        return std::hash<FString>{}(*key.string)
+             ^ std::hash<uInt64>{}(key.colors)
+             ^ (std::hash<uInt32>{}(key.style) << 1);
+      }
+    };
+
+    // Constant
+    static constexpr std::size_t MAX_STRING_LENGTH = 128;
+
+    // Methods
+    auto find (const Key& key) -> const FCharVector*
+    {
+      // The key may refer to the string of the caller,
+      // so no string is copied for a lookup
+      auto iter = index.find(key);
+
+      if ( iter == index.end() )
+        return nullptr;
+
+      // Move the entry to the front of the LRU list
+      entries.splice (entries.begin(), entries, iter->second);
+      return &iter->second->run;
+    }
+
+    void insert (const Key& key, FCharVector&& run)
+    {
+      if ( entries.size() >= MAX_ENTRIES )
+      {
+        index.erase(entries.back().key);  // Drop the least recently used
+        entries.pop_back();
+      }
+
+      // Only an inserted entry gets its own copy of the string
+      entries.emplace_front (*key.string, std::move(run));
+      auto& entry = entries.front();
+      entry.key = { &entry.string, key.colors, key.style };
+      index.emplace (entry.key, entries.begin());
+    }
+
+  private:
+    struct Entry
+    {
+      Entry (const FString& str, FCharVector&& char_run)
+        : string{str}
+        , run{std::move(char_run)}
+      { }
+
+      FString     string;
+      FCharVector run;
+      Key         key{};  // Refers to the string of this entry
+    };
+
+    // Constant
+    static constexpr std::size_t MAX_ENTRIES = 256;
+
+    // Data members
+    std::list<Entry>  entries{};  // Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index{};
+};
+
+//----------------------------------------------------------------------
+static auto getGlyphRunCacheInstance() -> GlyphRunCache&
+{
+  static const auto& run_cache = std::make_unique<GlyphRunCache>();
+  return *run_cache;
+}
+
+}  // namespace internal
+
 //----------------------------------------------------------------------
 // class FVTermBuffer
 //----------------------------------------------------------------------
@@ -73,38 +177,34 @@ auto FVTermBuffer::toString() const -> FString
 //----------------------------------------------------------------------
 auto FVTermBuffer::print (const FString& string) -> int
 {
+  // Short strings such as labels and menu items are printed with
+  // the same attributes again and again. Their character run is
+  // taken from the glyph run cache instead of being analyzed again.
+
+  static auto& run_cache = internal::getGlyphRunCacheInstance();
   checkCapacity(data, data.size() + string.getLength());
   getNextCharacterAttribute();
-  UnicodeBoundary ucb{string.cbegin(), string.cend(), string.cbegin(), 0};
 
-  for (auto&& ch : string)
+  if ( string.getLength() > internal::GlyphRunCache::MAX_STRING_LENGTH )
   {
-    auto width = getColumnWidth(ch);
-    auto ctrl_char = std::iswcntrl(wint_t(ch));
-
-    if ( width == 0 && ! ctrl_char )  // zero-width character
-    {
-      if ( ucb.iter == ucb.cbegin )
-        ++ucb.cbegin;
-
-      ++ucb.iter;
-    }
-    else if ( ucb.iter != ucb.cbegin )
-      add(ucb);
+    shape(string);
+    return int(string.getLength());
+  }
 
-    if ( ucb.iter == ucb.cbegin && (width > 0 || is7bit(ch)) )  // 1st char
-      ++ucb.iter;
+  const internal::GlyphRunCache::Key key { &string
+                                         , getRunColors()
+                                         , getRunStyle() };
 
-    if ( width > 0 )
-      ucb.char_width += width;
-
-    if ( ctrl_char )
-      add(ucb);
+  if ( const auto run = run_cache.find(key) )
+  {
+    data.insert (data.end(), run->cbegin(), run->cend());
+    return int(string.getLength());
   }
 
-  if ( ucb.iter == ucb.cend )
-    add(ucb);
-
+  const auto run_begin = data.size();
+  shape(string);
+  FCharVector run(data.cbegin() + difference_type(run_begin), data.cend());
+  run_cache.insert (key, std::move(run));
   return int(string.getLength());
 }
 
@@ -147,6 +247,62 @@ inline void FVTermBuffer::getNextCharacterAttribute()
   nc.attr.byte[3] = 0;
 }
 
+//----------------------------------------------------------------------
+inline auto FVTermBuffer::getRunColors() const -> uInt64
+{
+  return uInt64(nc.fg_color) | uInt64(nc.bg_color) << 32;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTermBuffer::getRunStyle() const -> uInt32
+{
+  // Packs the attributes and the encoding that affect
+  // the characters of a run
+
+  static const auto& fterm_data = FTermData::getInstance();
+  const auto encoding = fterm_data.getTerminalEncoding();
+  return uInt32(nc.attr.byte[0])
+       | uInt32(nc.attr.byte[1]) << 8
+       | uInt32(encoding) << 16;
+}
+
+//----------------------------------------------------------------------
+void FVTermBuffer::shape (const FString& string)
+{
+  // Converts the string into character cells with grapheme
+  // clusters and column widths
+
+  UnicodeBoundary ucb{string.cbegin(), string.cend(), string.cbegin(), 0};
+
+  for (auto&& ch : string)
+  {
+    auto width = getColumnWidth(ch);
+    auto ctrl_char = std::iswcntrl(wint_t(ch));
+
+    if ( width == 0 && ! ctrl_char )  // zero-width character
+    {
+      if ( ucb.iter == ucb.cbegin )
+        ++ucb.cbegin;
+
+      ++ucb.iter;
+    }
+    else if ( ucb.iter != ucb.cbegin )
+      add(ucb);
+
+    if ( ucb.iter == ucb.cbegin && (width > 0 || is7bit(ch)) )  // 1st char
+      ++ucb.iter;
+
+    if ( width > 0 )
+      ucb.char_width += width;
+
+    if ( ctrl_char )
+      add(ucb);
+  }
+
+  if ( ucb.iter == ucb.cend )
+    add(ucb);
+}
+
 //----------------------------------------------------------------------
 void FVTermBuffer::add (UnicodeBoundary& ucb)
 {
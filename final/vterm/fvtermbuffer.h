@@ -132,6 +132,9 @@ class FVTermBuffer
     };
 
     void getNextCharacterAttribute();
+    auto getRunColors() const -> uInt64;
+    auto getRunStyle() const -> uInt32;
+    void shape (const FString&);
     void add (UnicodeBoundary&);
 
     // Data member
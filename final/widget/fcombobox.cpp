@@ -98,10 +98,8 @@ void FDropDownListBox::hide()
   if ( ! isVisible() )
     return;
 
-  FWindow::hide();
+  FWindow::hide();  // Restores the terminal area below the list
   setOpenMenu(nullptr);
-  const auto& t_geometry = getTermGeometryWithShadow();
-  restoreVTerm (t_geometry);
 }
 
 
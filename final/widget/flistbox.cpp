@@ -21,6 +21,7 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 
 #include "final/fapplication.h"
@@ -645,6 +646,26 @@ inline void FListBox::updateRedrawParameters (std::size_t& start, std::size_t& n
   num = std::max(last_pos, current_pos) + 1;
 }
 
+//----------------------------------------------------------------------
+inline void FListBox::scrollListRows (std::size_t num)
+{
+  // Scrolls the printed list rows in the terminal by one line,
+  // so that only the new row has to be output
+
+  const int dy = scroll.yoffset - scroll.last_yoffset;
+
+  if ( scroll.last_yoffset < 0 || std::abs(dy) != 1 )
+    return;
+
+  const FRect box { getTermX() + 1, getTermY() + 1
+                  , getWidth() - 2 - nf_offset, num };
+
+  if ( dy > 0 )
+    scrollPrintRegionForward (box);
+  else
+    scrollPrintRegionReverse (box);
+}
+
 //----------------------------------------------------------------------
 inline void FListBox::finalizeDrawing()
 {
@@ -664,6 +685,8 @@ void FListBox::drawList()
 
   if ( canRedrawPartialList() )
     updateRedrawParameters(start, num);
+  else
+    scrollListRows(num);
 
   auto iter = index2iterator(start + std::size_t(scroll.yoffset));
 
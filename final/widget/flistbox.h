@@ -351,6 +351,7 @@ class FListBox : public FWidget
     auto calculateNumberItemsToDraw() const -> std::size_t;
     auto canRedrawPartialList() const -> bool;
     void updateRedrawParameters (std::size_t&, std::size_t&) const;
+    void scrollListRows (std::size_t);
     void finalizeDrawing();
     void drawList();
     void drawListLine (int, FListBoxItems::iterator, bool);
@@ -1020,6 +1020,20 @@ void FListView::sort()
   processChanged();
 }
 
+//----------------------------------------------------------------------
+void FListView::flushChanges()
+{
+  // Post-processing of the insertions within an update batch
+
+  if ( ! insertion_pending )
+    return;
+
+  insertion_pending = false;
+  sort();
+  recalculateVerticalBar (getCount());
+  processChanged();
+}
+
 //----------------------------------------------------------------------
 void FListView::onKeyPress (FKeyEvent* ev)
 {
@@ -2140,6 +2154,13 @@ inline void FListView::afterInsertion()
   // The visible area of the list begins with the first element
   scroll.first_visible_line = data.itemlist.begin();
 
+  if ( isUpdating() )
+  {
+    // Batched insertions are sorted once in flushChanges()
+    insertion_pending = true;
+    return;
+  }
+
   // Sort list by a column (only if activated)
   sort();
 
@@ -422,6 +422,7 @@ class FListView : public FWidget
     auto getData() const & -> const FListViewItems&;
 
     virtual void sort();
+    void flushChanges() override;
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
@@ -612,6 +613,7 @@ class FListView : public FWidget
     std::size_t     max_line_width{1};
     bool            tree_view{false};
     bool            has_checkable_items{false};
+    bool            insertion_pending{false};
     ListViewData    data{};
     SortState       sorting{};
     ScrollingState  scroll{};
@@ -169,7 +169,9 @@ void FScrollbar::resize()
 //----------------------------------------------------------------------
 void FScrollbar::redraw()
 {
-  if ( isShown() )
+  if ( isUpdating() )
+    FWidget::redraw();  // Deferred until the update batch is closed
+  else if ( isShown() )
     draw();
 }
 
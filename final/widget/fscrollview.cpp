@@ -65,11 +65,7 @@ void FScrollView::setScrollWidth (std::size_t width)
   if ( viewport )
   {
     scroll_geometry.setWidth (width);
-    resizeArea (scroll_geometry, viewport.get());
-    setColor();
-    FScrollView::clearArea();
-    addLocalPreprocessingHandler();
-    setChildPrintArea (viewport.get());
+    resizeViewport();
   }
 
   hbar->setMaximum (int(width - getViewportWidth()));
@@ -91,11 +87,7 @@ void FScrollView::setScrollHeight (std::size_t height)
   if ( viewport )
   {
     scroll_geometry.setHeight (height);
-    resizeArea (scroll_geometry, viewport.get());
-    setColor();
-    clearArea();
-    addLocalPreprocessingHandler();
-    setChildPrintArea (viewport.get());
+    resizeViewport();
   }
 
   vbar->setMaximum (int(height - getViewportHeight()));
@@ -118,11 +110,7 @@ void FScrollView::setScrollSize (const FSize& size)
   if ( viewport )
   {
     scroll_geometry.setSize (width, height);
-    resizeArea (scroll_geometry, viewport.get());
-    setColor();
-    FScrollView::clearArea();
-    addLocalPreprocessingHandler();
-    setChildPrintArea (viewport.get());
+    resizeViewport();
   }
 
   const auto xoffset_end = int(getScrollWidth() - getViewportWidth());
@@ -329,6 +317,37 @@ void FScrollView::setVerticalScrollBarMode (ScrollBarMode mode)
     setVerticalScrollBarVisibility();
 }
 
+//----------------------------------------------------------------------
+void FScrollView::setTilePainter (TilePainter&& painter)
+{
+  // In the virtualized mode, the painter renders the scroll content
+  // on demand in tiles. Only the tiles around the visible region are
+  // kept, so the scroll size is not limited by the memory required
+  // for a full-size viewport. Child widgets are not displayed.
+
+  tile_painter = std::move(painter);
+
+  if ( viewport )
+    resizeViewport();
+
+  invalidateTiles();
+}
+
+//----------------------------------------------------------------------
+void FScrollView::unsetTilePainter()
+{
+  if ( ! isVirtualized() )
+    return;
+
+  tile_painter = nullptr;
+
+  if ( viewport )
+  {
+    resizeViewport();
+    viewport->has_changes = true;
+  }
+}
+
 //----------------------------------------------------------------------
 void FScrollView::clearArea (wchar_t fillchar)
 {
@@ -386,6 +405,18 @@ void FScrollView::scrollBy (int dx, int dy)
   scrollTo (1 + getScrollX() + dx, 1 + getScrollY() + dy);
 }
 
+//----------------------------------------------------------------------
+void FScrollView::invalidateTiles()
+{
+  // The tile painter is called again for all visible tiles
+
+  for (auto& tile : tiles)
+    tile.index.setPoint(-1, -1);
+
+  if ( viewport )
+    viewport->has_changes = true;
+}
+
 //----------------------------------------------------------------------
 void FScrollView::draw()
 {
@@ -718,16 +749,21 @@ void FScrollView::copy2area()
 
   for (auto y{0}; y < y_end; y++)  // line loop
   {
-    // viewport character
-    const auto& vc = viewport->getFChar(dx, dy + y);
     // area character
     auto& ac = printarea->getFChar(ax, ay + y);
-    std::memcpy (&ac, &vc, sizeof(FChar) * unsigned(x_end));
+
+    if ( isVirtualized() )
+      copyTileLine (&ac, FPoint{dx, dy + y}, x_end);
+    else
+    {
+      // viewport character
+      const auto& vc = viewport->getFChar(dx, dy + y);
+      std::memcpy (&ac, &vc, sizeof(FChar) * unsigned(x_end));
+    }
+
     auto& line_changes = printarea->changes[unsigned(ay + y)];
-    line_changes.xmin = std::min(line_changes.xmin, uInt(ax));
-    line_changes.xmin = std::min(line_changes.xmin, uInt(width + rsh - 1));
-    line_changes.xmax = std::max(line_changes.xmax, uInt(ax + x_end - 1));
-    line_changes.xmax = std::min(line_changes.xmax, uInt(width + rsh - 1));
+    line_changes.mark ( std::min(uInt(ax), uInt(width + rsh - 1))
+                      , std::min(uInt(ax + x_end - 1), uInt(width + rsh - 1)) );
   }
 
   setViewportCursor();
@@ -756,6 +792,63 @@ inline auto FScrollView::getViewportCursorPos() -> FPoint
   return { -1, -1 };
 }
 
+//----------------------------------------------------------------------
+inline auto FScrollView::getViewportAreaGeometry() const -> FRect
+{
+  // The virtualized mode keeps the scroll content in the tile cache
+
+  if ( isVirtualized() )
+    return { scroll_geometry.getPos(), FSize{1, 1} };
+
+  return scroll_geometry;
+}
+
+//----------------------------------------------------------------------
+auto FScrollView::getTileArea (int column, int row) -> const FTermArea*
+{
+  // Returns the area of a cached tile. A missing tile is painted
+  // into a new cache entry or into the least recently used one.
+
+  tile_use_count++;
+  const FPoint index{column, row};
+  auto iter = std::find_if ( tiles.begin(), tiles.end()
+                           , [&index] (const FTile& tile)
+                             {
+                               return tile.index == index;
+                             } );
+
+  if ( iter != tiles.end() )
+  {
+    iter->last_use = tile_use_count;
+    return iter->area.get();
+  }
+
+  // Visible tiles plus a margin of one tile on each side
+  const auto max_tiles = ( getViewportWidth() / std::size_t(tile_width) + 4 )
+                       * ( getViewportHeight() / std::size_t(tile_height) + 4 );
+
+  if ( tiles.size() < max_tiles )
+  {
+    const FSize tile_size{std::size_t(tile_width + 2), std::size_t(tile_height)};
+    tiles.emplace_back();
+    tiles.back().area = createArea(FRect{FPoint{0, 0}, tile_size});
+    iter = tiles.end() - 1;
+  }
+  else
+  {
+    iter = std::min_element ( tiles.begin(), tiles.end()
+                            , [] (const FTile& lhs, const FTile& rhs)
+                              {
+                                return lhs.last_use < rhs.last_use;
+                              } );
+  }
+
+  iter->index = index;
+  iter->last_use = tile_use_count;
+  paintTile (*iter);
+  return iter->area.get();
+}
+
 //----------------------------------------------------------------------
 void FScrollView::init()
 {
@@ -801,6 +894,79 @@ inline void FScrollView::createViewport (const FSize& size) noexcept
   FScrollView::clearArea();
 }
 
+//----------------------------------------------------------------------
+inline void FScrollView::resizeViewport()
+{
+  tiles.clear();
+  resizeArea (getViewportAreaGeometry(), viewport.get());
+  setColor();
+  FScrollView::clearArea();
+  addLocalPreprocessingHandler();
+  setChildPrintArea (viewport.get());
+}
+
+//----------------------------------------------------------------------
+void FScrollView::paintTile (const FTile& tile)
+{
+  // Renders the tile content line by line with the tile painter.
+  // The tile area has one extra column on each side, so that
+  // full-width characters crossing a tile edge are complete.
+
+  auto area = tile.area.get();
+  const int x = tile.index.getX() * tile_width;
+  const int y = tile.index.getY() * tile_height;
+  const int start = std::max(0, x - 1);  // Scroll column of the line start
+  const int area_x = start - x + 1;  // Area column of the line start
+  const auto width = std::min( tile_width + 2 - area_x
+                             , int(getScrollWidth()) - start );
+  const auto height = std::min(tile_height, int(getScrollHeight()) - y);
+  FVTermBuffer line{};
+  setColor();
+  clearArea (area);
+
+  for (auto row{0}; row < height; row++)
+  {
+    tile_painter (line, FPoint{start + 1, y + row + 1}, std::size_t(width));
+    area->setCursorPos (area_x + 1, row + 1);
+    int column{0};
+
+    for (const auto& fchar : line)
+    {
+      column += ( fchar.attr.bit.char_width == 2 ) ? 2 : 1;
+
+      if ( column > width )  // Clip at the right area edge
+        break;
+
+      print (area, fchar);
+    }
+
+    line.clear();
+  }
+
+  area->has_changes = false;  // A tile is only copied, not composited
+}
+
+//----------------------------------------------------------------------
+void FScrollView::copyTileLine (FChar* dest, const FPoint& pos, int length)
+{
+  // Copies a line segment of the scroll content from the tile cache
+
+  int x = pos.getX();
+  const int y = pos.getY();
+  const int x_end = x + length;
+
+  while ( x < x_end )
+  {
+    const auto tile_area = getTileArea(x / tile_width, y / tile_height);
+    const int tile_x = x % tile_width;
+    const int count = std::min(tile_width - tile_x, x_end - x);
+    const auto& tc = tile_area->getFChar(tile_x + 1, y % tile_height);
+    std::memcpy (dest, &tc, sizeof(FChar) * unsigned(count));
+    dest += count;
+    x += count;
+  }
+}
+
 //----------------------------------------------------------------------
 void FScrollView::drawText ( const FString& label_text
                            , std::size_t hotkeypos )
@@ -48,8 +48,10 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "final/fwidget.h"
 #include "final/widget/fscrollbar.h"
@@ -71,6 +73,7 @@ class FScrollView : public FWidget
     using FWidget::delAccelerator;
     using FWidget::print;
     using FWidget::setGeometry;
+    using TilePainter = std::function<void(FVTermBuffer&, const FPoint&, std::size_t)>;
 
     // Constructor
     explicit FScrollView (FWidget* = nullptr);
@@ -125,10 +128,13 @@ class FScrollView : public FWidget
     void unsetBorder();
     void setHorizontalScrollBarMode (ScrollBarMode);
     void setVerticalScrollBarMode (ScrollBarMode);
+    void setTilePainter (TilePainter&&);
+    void unsetTilePainter();
 
     // Inquiries
     auto hasBorder() const -> bool;
     auto isViewportPrint() const -> bool;
+    auto isVirtualized() const -> bool;
 
     // Methods
     void clearArea (wchar_t = L' ') override;
@@ -137,6 +143,7 @@ class FScrollView : public FWidget
     void scrollTo (const FPoint&);
     void scrollTo (int, int);
     void scrollBy (int, int);
+    void invalidateTiles();
     void print (const FPoint&) override;
     void draw() override;
     void drawBorder() override;
@@ -171,17 +178,31 @@ class FScrollView : public FWidget
     // Using-declaration
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
 
+    struct FTile
+    {
+      FPoint                      index{-1, -1};  // Tile column and row
+      std::unique_ptr<FTermArea>  area{};
+      uInt64                      last_use{0};
+    };
+
     // Constants
     static constexpr std::size_t vertical_border_spacing = 2;
     static constexpr std::size_t horizontal_border_spacing = 2;
+    static constexpr int tile_width = 64;
+    static constexpr int tile_height = 16;
 
     // Accessors
     auto getViewportCursorPos() -> FPoint;
+    auto getViewportAreaGeometry() const -> FRect;
+    auto getTileArea (int, int) -> const FTermArea*;
 
     // Methods
     void init();
     void addLocalPreprocessingHandler();
     void createViewport (const FSize&) noexcept;
+    void resizeViewport();
+    void paintTile (const FTile&);
+    void copyTileLine (FChar*, const FPoint&, int);
     void drawText (const FString&, std::size_t);
     auto getDisplayedTextLength (const FString&, const std::size_t) const -> std::size_t;
     void setLabelStyle() const;
@@ -214,6 +235,9 @@ class FScrollView : public FWidget
     FRect                      scroll_geometry{1, 1, 1, 1};
     FRect                      viewport_geometry{};
     std::unique_ptr<FTermArea> viewport{};  // virtual scroll content
+    TilePainter                tile_painter{};
+    std::vector<FTile>         tiles{};     // Tile cache of the virtualized mode
+    uInt64                     tile_use_count{0};
     FString                    text{};
     FScrollbarPtr              vbar{nullptr};
     FScrollbarPtr              hbar{nullptr};
@@ -299,6 +323,10 @@ inline auto FScrollView::hasBorder() const -> bool
 inline auto FScrollView::isViewportPrint() const -> bool
 { return ! use_own_print_area; }
 
+//----------------------------------------------------------------------
+inline auto FScrollView::isVirtualized() const -> bool
+{ return bool(tile_painter); }
+
 //----------------------------------------------------------------------
 inline void FScrollView::scrollTo (const FPoint& pos)
 { scrollTo(pos.getX(), pos.getY()); }
@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <cstdlib>
 #include <memory>
 
 #include "final/dialog/fdialog.h"
@@ -211,6 +212,8 @@ void FTextView::scrollTo (int x, int y)
   if ( ! isShown() || ! (changeX || changeY) )
     return;
 
+  const int last_xoffset = xoffset;
+  const int last_yoffset = yoffset;
   xoffset = std::max(0, std::min(x, xoffset_end));
   yoffset = std::max(0, std::min(y, yoffset_end));
 
@@ -226,6 +229,9 @@ void FTextView::scrollTo (int x, int y)
     vbar->drawBar();
   }
 
+  if ( xoffset == last_xoffset )
+    scrollTextLines (yoffset - last_yoffset);
+
   drawText();
 }
 
@@ -721,6 +727,25 @@ void FTextView::drawText()
     setReverse(false);
 }
 
+//----------------------------------------------------------------------
+inline void FTextView::scrollTextLines (int dy)
+{
+  // Scrolls the printed text lines in the terminal by one line,
+  // so that drawText() only has to output the new line
+
+  if ( std::abs(dy) != 1 || canSkipDrawing() )
+    return;
+
+  const auto num = std::min(getTextHeight(), getRows());
+  const FRect box { getTermX() + 1, getTermY() + 1 - nf_offset
+                  , getTextWidth(), num };
+
+  if ( dy > 0 )
+    scrollPrintRegionForward (box);
+  else
+    scrollPrintRegionReverse (box);
+}
+
 //----------------------------------------------------------------------
 inline auto FTextView::canSkipDrawing() const -> bool
 {
@@ -270,6 +270,7 @@ class FTextView : public FWidget
     void drawBorder() override;
     void drawScrollbars() const;
     void drawText();
+    void scrollTextLines (int);
     auto canSkipDrawing() const -> bool;
     void printLine (std::size_t);
     void addHighlighting ( FVTermBuffer&
@@ -989,6 +989,22 @@ inline void ConEmu::parseTerminalBuffer (std::size_t length, console con)
 
       i += 4;
     }
+    else if ( i < length - 8  // Request synchronized output mode (DECRQM)
+           && std::memcmp(&buffer[i], "\033[?2026$p", 9) == 0 )
+    {
+      if ( con == console::kitty )
+        write (fd_master, "\033[?2026;2$y", 12);
+
+      i += 8;  // Do not skip the following request
+    }
+    else if ( i < length - 6  // Request left/right margin mode (DECRQM)
+           && std::memcmp(&buffer[i], "\033[?69$p", 7) == 0 )
+    {
+      if ( con == console::xterm )
+        write (fd_master, "\033[?69;2$y", 10);
+
+      i += 6;  // Do not skip the following request
+    }
     else if ( i < length - 4  // Report xterm window's title
            && buffer[i] == '\033'
            && buffer[i + 1] == '['
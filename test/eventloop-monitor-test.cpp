@@ -20,6 +20,8 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <sys/select.h>
+
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -28,9 +30,13 @@
 #include <cppunit/TestResultCollector.h>
 #include <cppunit/TestRunner.h>
 
+#include <array>
 #include <chrono>
+#include <cstdio>
+#include <memory>
 #include <queue>
 #include <string>
+#include <vector>
 
 #include <final/final.h>
 #define USE_FINAL_H
@@ -214,6 +220,8 @@ class FSystemTest : public finalcut::FSystem
     auto pipe (finalcut::PipeData&) -> int override;
     auto open (const char*, int, ...) -> int override;
     auto close (int) -> int override;
+    auto write (int, const void*, std::size_t) -> ssize_t override;
+    auto select (int, fd_set*, fd_set*, fd_set*, struct timeval*) -> int override;
     auto fopen (const char*, const char*) -> FILE* override;
     auto fputs (const char*, FILE*) -> int override;
     auto fclose (FILE*) -> int override;
@@ -230,6 +238,12 @@ class FSystemTest : public finalcut::FSystem
     auto kevent ( int, const struct kevent*
                 , int, struct kevent*
                 , int, const struct timespec* ) -> int override;
+    auto timerfd_create (int, int) -> int override;
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override;
+    auto signalfd (int, const sigset_t*, int) -> int override;
+    auto pthread_sigmask (int, const sigset_t*, sigset_t*) -> int override;
     auto getuid() -> uid_t override;
     auto geteuid() -> uid_t override;
     auto getpwuid_r ( uid_t, struct passwd*, char*
@@ -242,6 +256,10 @@ class FSystemTest : public finalcut::FSystem
     void setTimerDeleteReturnValue (int);
     void setKqueueReturnValue (int);
     void setKeventReturnValue (int);
+    void setTimerfdCreateReturnValue (int);
+    void setTimerfdSettimeReturnValue (int);
+    void setSignalfdReturnValue (int);
+    void setPthreadSigmaskReturnValue (int);
 
   private:
     int pipe_ret_value{0};
@@ -251,6 +269,10 @@ class FSystemTest : public finalcut::FSystem
     int timer_delete_ret_value{0};
     int kqueue_ret_value{0};
     int kevent_ret_value{0};
+    int timerfd_create_ret_value{0};
+    int timerfd_settime_ret_value{0};
+    int signalfd_ret_value{0};
+    int pthread_sigmask_ret_value{0};
 };
 
 
@@ -326,6 +348,19 @@ inline auto FSystemTest::close (int file_descriptor) -> int
   return 0;
 }
 
+//----------------------------------------------------------------------
+inline auto FSystemTest::write (int fd, const void* buf, std::size_t count) -> ssize_t
+{
+  return ::write(fd, buf, count);
+}
+
+//----------------------------------------------------------------------
+inline auto FSystemTest::select ( int nfds, fd_set* readfds, fd_set* writefds
+                                 , fd_set* exceptfds, struct timeval* timeout ) -> int
+{
+  return ::select(nfds, readfds, writefds, exceptfds, timeout);
+}
+
 //----------------------------------------------------------------------
 inline auto FSystemTest::fopen (const char* path, const char* mode) -> FILE*
 {
@@ -431,6 +466,45 @@ inline auto FSystemTest::kevent ( int kq, const struct ::kevent* changelist
   return kevent_ret_value;
 }
 
+//----------------------------------------------------------------------
+inline auto FSystemTest::timerfd_create (int clockid, int flags) -> int
+{
+  std::cerr << "Call: timerfd_create (clockid=" << clockid
+            << ", flags=" << flags << ")\n";
+  return timerfd_create_ret_value;
+}
+
+//----------------------------------------------------------------------
+inline auto FSystemTest::timerfd_settime ( int fd, int flags
+                                         , const struct itimerspec* new_value
+                                         , struct itimerspec* old_value ) -> int
+{
+  std::cerr << "Call: timerfd_settime (fd=" << fd
+            << ", flags=" << flags
+            << ", new_value=" << new_value
+            << ", old_value=" << old_value << ")\n";
+  return timerfd_settime_ret_value;
+}
+
+//----------------------------------------------------------------------
+inline auto FSystemTest::signalfd (int fd, const sigset_t* mask, int flags) -> int
+{
+  std::cerr << "Call: signalfd (fd=" << fd
+            << ", mask=" << mask
+            << ", flags=" << flags << ")\n";
+  return signalfd_ret_value;
+}
+
+//----------------------------------------------------------------------
+inline auto FSystemTest::pthread_sigmask ( int how, const sigset_t* set
+                                         , sigset_t* oldset ) -> int
+{
+  std::cerr << "Call: pthread_sigmask (how=" << how
+            << ", set=" << set
+            << ", oldset=" << oldset << ")\n";
+  return pthread_sigmask_ret_value;
+}
+
 //----------------------------------------------------------------------
 inline auto FSystemTest::getuid() -> uid_t
 {
@@ -498,6 +572,30 @@ inline void FSystemTest::setKeventReturnValue (int ret_val)
   kevent_ret_value = ret_val;
 }
 
+//----------------------------------------------------------------------
+inline void FSystemTest::setTimerfdCreateReturnValue (int ret_val)
+{
+  timerfd_create_ret_value = ret_val;
+}
+
+//----------------------------------------------------------------------
+inline void FSystemTest::setTimerfdSettimeReturnValue (int ret_val)
+{
+  timerfd_settime_ret_value = ret_val;
+}
+
+//----------------------------------------------------------------------
+inline void FSystemTest::setSignalfdReturnValue (int ret_val)
+{
+  signalfd_ret_value = ret_val;
+}
+
+//----------------------------------------------------------------------
+inline void FSystemTest::setPthreadSigmaskReturnValue (int ret_val)
+{
+  pthread_sigmask_ret_value = ret_val;
+}
+
 
 //----------------------------------------------------------------------
 // class StringParser
@@ -598,6 +696,7 @@ class EventloopMonitorTest : public CPPUNIT_NS::TestFixture
     void noArgumentTest();
     void PipeDataTest();
     void eventLoopTest();
+    void manyMonitorsTest();
     void setMonitorTest();
     void IoMonitorTest();
     void SignalMonitorTest();
@@ -618,6 +717,7 @@ class EventloopMonitorTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (noArgumentTest);
     CPPUNIT_TEST (PipeDataTest);
     CPPUNIT_TEST (eventLoopTest);
+    CPPUNIT_TEST (manyMonitorsTest);
     CPPUNIT_TEST (setMonitorTest);
     CPPUNIT_TEST (IoMonitorTest);
     CPPUNIT_TEST (SignalMonitorTest);
@@ -747,6 +847,93 @@ void EventloopMonitorTest::eventLoopTest()
   CPPUNIT_ASSERT ( mon.isActive() );
   signal(SIGALRM, SIG_DFL);
   signal_handler = [] (int) { };  // Do nothing
+
+  // Single loop iteration with timeout
+  const auto start = std::chrono::steady_clock::now();
+  CPPUNIT_ASSERT ( ! eloop.runOnce(20) );  // No event within 20 ms
+  CPPUNIT_ASSERT ( std::chrono::steady_clock::now() - start
+                   >= std::chrono::milliseconds(20) );
+  uint64_t buf{std::numeric_limits<uint64_t>::max()};
+  CPPUNIT_ASSERT ( ::write (pipe_fd[1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( eloop.runOnce(0) );  // Event is dispatched immediately
+  CPPUNIT_ASSERT ( ! eloop.runOnce(0) );
+  ::close(pipe_fd[0]);
+  ::close(pipe_fd[1]);
+}
+
+//----------------------------------------------------------------------
+void EventloopMonitorTest::manyMonitorsTest()
+{
+  // More monitors than the former limit of 50 file descriptors
+  static constexpr std::size_t monitor_count{100};
+  finalcut::EventLoop eloop{};
+  std::vector<std::unique_ptr<Monitor_protected>> monitors{};
+  std::vector<std::array<int, 2>> pipes(monitor_count, {{-1, -1}});
+  std::vector<int> trigger_count(monitor_count, 0);
+
+  for (std::size_t i{0}; i < monitor_count; i++)
+  {
+    CPPUNIT_ASSERT ( ::pipe(pipes[i].data()) == 0 );
+    monitors.emplace_back(std::make_unique<Monitor_protected>(&eloop));
+    auto& mon = *monitors.back();
+    mon.p_setEvents (POLLIN);
+    mon.p_setFileDescriptor (pipes[i][0]);
+    mon.p_setHandler ([&pipes, &trigger_count, i] (const finalcut::Monitor*, short)
+    {
+      uint64_t buf{0};
+      CPPUNIT_ASSERT ( ::read(pipes[i][0], &buf, sizeof(buf)) == sizeof(buf) );
+      trigger_count[i]++;
+    });
+    mon.resume();
+  }
+
+#if defined(__linux__)
+  CPPUNIT_ASSERT ( eloop.isEpollBackend() );
+#endif
+
+  const uint64_t buf{1};
+  CPPUNIT_ASSERT ( ::write (pipes[monitor_count - 1][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( eloop.runOnce(100) );
+  CPPUNIT_ASSERT ( trigger_count[monitor_count - 1] == 1 );
+  CPPUNIT_ASSERT ( ! eloop.runOnce(0) );
+
+  // A suspended monitor is not triggered
+  monitors[75]->suspend();
+  CPPUNIT_ASSERT ( ::write (pipes[75][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( ! eloop.runOnce(0) );
+  monitors[75]->resume();
+  CPPUNIT_ASSERT ( eloop.runOnce(0) );
+  CPPUNIT_ASSERT ( trigger_count[75] == 1 );
+
+  // Regular files cannot be monitored with epoll,
+  // so the event loop continues with the poll backend
+  FILE* file = std::tmpfile();
+  CPPUNIT_ASSERT ( file != nullptr );
+  Monitor_protected file_monitor{&eloop};
+  int file_events{0};
+  file_monitor.p_setEvents (POLLIN);
+  file_monitor.p_setFileDescriptor (fileno(file));
+  file_monitor.p_setHandler ([&file_events] (const finalcut::Monitor*, short)
+  {
+    file_events++;
+  });
+  file_monitor.resume();
+  CPPUNIT_ASSERT ( ! eloop.isEpollBackend() );
+  CPPUNIT_ASSERT ( eloop.runOnce(0) );  // A regular file is always readable
+  CPPUNIT_ASSERT ( file_events == 1 );
+  file_monitor.suspend();
+  CPPUNIT_ASSERT ( ::write (pipes[10][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( eloop.runOnce(100) );
+  CPPUNIT_ASSERT ( trigger_count[10] == 1 );
+  CPPUNIT_ASSERT ( ! eloop.runOnce(0) );
+  std::fclose(file);
+  monitors.clear();
+
+  for (auto&& pipe_fd : pipes)
+  {
+    ::close(pipe_fd[0]);
+    ::close(pipe_fd[1]);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -937,15 +1124,24 @@ void EventloopMonitorTest::exceptionTest()
   CPPUNIT_ASSERT_THROW ( signal_monitor1.init(SIGALRM, callback_handler, nullptr)
                        , std::invalid_argument );
 
-  // No pipe could be established
   std::unique_ptr<finalcut::FSystem> fsys = std::make_unique<test::FSystemTest>();
   finalcut::FSystem::getInstance().swap(fsys);
   auto fsys_ptr = static_cast<test::FSystemTest*>(finalcut::FSystem::getInstance().get());
-  fsys_ptr->setPipeReturnValue(-1);
   std::cout << "\n";
+
+#if defined(__linux__)
+  // No signalfd could be established
+  fsys_ptr->setSignalfdReturnValue(-1);
+  CPPUNIT_ASSERT_THROW ( signal_monitor1.init(SIGTERM, callback_handler, nullptr)
+                       , finalcut::monitor_error );
+  fsys_ptr->setSignalfdReturnValue(0);
+#else
+  // No pipe could be established
+  fsys_ptr->setPipeReturnValue(-1);
   CPPUNIT_ASSERT_THROW ( signal_monitor1.init(SIGTERM, callback_handler, nullptr)
                        , finalcut::monitor_error );
   fsys_ptr->setPipeReturnValue(0);
+#endif
 
   // Double monitor instance for one signal
   CPPUNIT_ASSERT_NO_THROW ( signal_monitor1.init(SIGTERM, callback_handler, nullptr) );
@@ -958,12 +1154,21 @@ void EventloopMonitorTest::exceptionTest()
   CPPUNIT_ASSERT_THROW ( signal_monitor1.init(SIGINT, callback_handler, nullptr)
                        , finalcut::monitor_error );
 
+  finalcut::SignalMonitor signal_monitor3{&eloop};
+
+#if defined(__linux__)
+  // Signal mask cannot be changed
+  fsys_ptr->setPthreadSigmaskReturnValue(EINVAL);
+  CPPUNIT_ASSERT_THROW ( signal_monitor3.init(SIGHUP, callback_handler, nullptr)
+                       , std::system_error );
+  fsys_ptr->setPthreadSigmaskReturnValue(0);
+#else
   // Sigaction error
   fsys_ptr->setSigactionReturnValue(-1);
-  finalcut::SignalMonitor signal_monitor3{&eloop};
   CPPUNIT_ASSERT_THROW ( signal_monitor3.init(SIGHUP, callback_handler, nullptr)
                        , std::system_error );
   fsys_ptr->setSigactionReturnValue(0);
+#endif
   CPPUNIT_ASSERT_NO_THROW ( signal_monitor3.init(SIGHUP, callback_handler, nullptr) );
 
   // Posix timer monitor
@@ -997,6 +1202,31 @@ void EventloopMonitorTest::exceptionTest()
   fsys_ptr->setTimerSettimeReturnValue(0);
   CPPUNIT_ASSERT_NO_THROW ( posix_timer_monitor.setInterval(t1, t2) );
 
+#if defined(__linux__)
+  // Timerfd timer monitor
+  //----------------------
+
+  // No timerfd could be created
+  finalcut::TimerfdTimer timerfd_timer_monitor{&eloop};
+  fsys_ptr->setTimerfdCreateReturnValue(-1);
+  CPPUNIT_ASSERT_THROW ( timerfd_timer_monitor.init(callback_handler, nullptr)
+                       , finalcut::monitor_error );
+  fsys_ptr->setTimerfdCreateReturnValue(0);
+
+  CPPUNIT_ASSERT_NO_THROW ( timerfd_timer_monitor.init(callback_handler, nullptr) );
+
+  // Already initialised
+  CPPUNIT_ASSERT_THROW ( timerfd_timer_monitor.init(callback_handler, nullptr)
+                       , finalcut::monitor_error );
+
+  // Timer interval cannot be set
+  fsys_ptr->setTimerfdSettimeReturnValue(-1);
+  CPPUNIT_ASSERT_THROW ( timerfd_timer_monitor.setInterval(t1, t2)
+                       , std::system_error );
+  fsys_ptr->setTimerfdSettimeReturnValue(0);
+  CPPUNIT_ASSERT_NO_THROW ( timerfd_timer_monitor.setInterval(t1, t2) );
+#endif  // defined(__linux__)
+
   // Kqueue timer monitor
   //---------------------
 
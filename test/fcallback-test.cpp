@@ -21,6 +21,7 @@
 ***********************************************************************/
 
 #include <utility>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -129,6 +130,7 @@ class FCallbackTest : public CPPUNIT_NS::TestFixture
     void functionReferenceCallbackTest();
     void functionPointerCallbackTest();
     void ownWidgetTest();
+    void signalIdTest();
 
   private:
     // Adds code needed to register the test suite
@@ -143,6 +145,7 @@ class FCallbackTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (functionReferenceCallbackTest);
     CPPUNIT_TEST (functionPointerCallbackTest);
     CPPUNIT_TEST (ownWidgetTest);
+    CPPUNIT_TEST (signalIdTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -533,6 +536,57 @@ void FCallbackTest::ownWidgetTest()
   CPPUNIT_ASSERT ( value == 3141596 );
 }
 
+//----------------------------------------------------------------------
+void FCallbackTest::signalIdTest()
+{
+  const auto id1 = finalcut::FCallback::getSignalId("id-test-1");
+  const auto id2 = finalcut::FCallback::getSignalId("id-test-2");
+  CPPUNIT_ASSERT ( id1 != id2 );
+  CPPUNIT_ASSERT ( finalcut::FCallback::getSignalId("id-test-1") == id1 );
+  CPPUNIT_ASSERT ( finalcut::FCallback::getSignalId(finalcut::FString("id-test-2")) == id2 );
+
+  finalcut::FCallback cb;
+  std::vector<int> order{};
+  cb.addCallback ("id-test-1", [&order] () { order.push_back(1); });
+  cb.addCallback ("id-test-2", [&order] () { order.push_back(2); });
+  cb.addCallback ("id-test-1", [&order] () { order.push_back(3); });
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 3 );
+
+  // Emit by name and by identifier
+  cb.emitCallback ("id-test-1");
+  CPPUNIT_ASSERT ( order == (std::vector<int>{1, 3}) );
+  cb.emitCallback (id2);
+  CPPUNIT_ASSERT ( order == (std::vector<int>{1, 3, 2}) );
+  cb.emitCallback (finalcut::FString("id-test-1"));
+  CPPUNIT_ASSERT ( order == (std::vector<int>{1, 3, 2, 1, 3}) );
+
+  // Unknown signal names are not registered by an emit
+  cb.emitCallback ("id-test-unknown");
+  CPPUNIT_ASSERT ( order.size() == 5 );
+
+  // Removing a signal keeps the other signals
+  cb.delCallback ("id-test-1");
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 1 );
+  cb.emitCallback (id1);
+  cb.emitCallback ("id-test-2");
+  CPPUNIT_ASSERT ( order == (std::vector<int>{1, 3, 2, 1, 3, 2}) );
+
+  // A callback can remove callbacks during the emit
+  cb.addCallback ( "id-test-2"
+                 , [&cb, &order] ()
+                   {
+                     order.push_back(4);
+                     cb.delCallback ("id-test-2");
+                   } );
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 2 );
+  order.clear();
+  cb.emitCallback ("id-test-2");
+  CPPUNIT_ASSERT ( order == (std::vector<int>{2, 4}) );
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 0 );
+  cb.emitCallback (id2);
+  CPPUNIT_ASSERT ( order.size() == 2 );
+}
+
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FCallbackTest);
 
@@ -538,6 +538,18 @@ void FKeyboardTest::severalKeysTest()
   CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::F3 );
   CPPUNIT_ASSERT ( key_released == finalcut::FKey::F3 );
   clear();
+
+  // More keys than fit into the key queue (read in one chunk)
+  input(std::string(40, 'x') + "\033[A");
+  processInput();
+  CPPUNIT_ASSERT ( number_of_keys == 32 );
+  CPPUNIT_ASSERT ( keyboard->hasUnprocessedInput() );
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( number_of_keys == 41 );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Up );
+  CPPUNIT_ASSERT ( ! keyboard->hasUnprocessedInput() );
+  clear();
 }
 
 //----------------------------------------------------------------------
@@ -66,6 +66,9 @@ class FOptiAttrTest : public CPPUNIT_NS::TestFixture
     void vga2ansiTest();
     void sgrOptimizerTest();
     void fakeReverseTest();
+    void transitionCacheTest();
+    void directSGRTest();
+    void trueColorTest();
     void ansiTest();
     void vt100Test();
     void xtermTest();
@@ -89,6 +92,9 @@ class FOptiAttrTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (vga2ansiTest);
     CPPUNIT_TEST (sgrOptimizerTest);
     CPPUNIT_TEST (fakeReverseTest);
+    CPPUNIT_TEST (transitionCacheTest);
+    CPPUNIT_TEST (directSGRTest);
+    CPPUNIT_TEST (trueColorTest);
     CPPUNIT_TEST (ansiTest);
     CPPUNIT_TEST (vt100Test);
     CPPUNIT_TEST (xtermTest);
@@ -433,6 +439,254 @@ void FOptiAttrTest::fakeReverseTest()
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 }
 
+//----------------------------------------------------------------------
+void FOptiAttrTest::transitionCacheTest()
+{
+  finalcut::FStartOptions::getInstance().sgr_optimizer = false;
+  finalcut::FOptiAttr oa;
+  oa.setDefaultColorSupport();  // ANSI default color
+  oa.setMaxColor (8);
+  oa.setNoColorVideo (0);
+  oa.set_enter_bold_mode (CSI "1m");
+  oa.set_exit_bold_mode (CSI "22m");
+  oa.set_enter_reverse_mode (CSI "7m");
+  oa.set_exit_reverse_mode (CSI "27m");
+  oa.set_exit_attribute_mode (CSI "0m");
+  oa.set_a_foreground_color (CSI "3%p1%dm");
+  oa.set_a_background_color (CSI "4%p1%dm");
+  oa.set_orig_pair (CSI "39;49m");
+  oa.initialize();
+
+  finalcut::FChar plain{};
+  finalcut::FChar colored{};
+  colored.fg_color = finalcut::FColor::LightGray;
+  colored.bg_color = finalcut::FColor::Blue;
+  finalcut::FChar bold_reverse{colored};
+  bold_reverse.attr.bit.bold = true;
+  bold_reverse.attr.bit.reverse = true;
+
+  // Calculate each transition once
+  finalcut::FChar term{};
+  finalcut::FChar next{colored};
+  const std::string to_colored = oa.changeAttribute(term, next);
+  CPPUNIT_ASSERT_STRING ( to_colored, CSI "37m" CSI "44m" );
+  CPPUNIT_ASSERT ( term == colored );
+  next = bold_reverse;
+  const std::string to_bold_reverse = oa.changeAttribute(term, next);
+  CPPUNIT_ASSERT ( ! to_bold_reverse.empty() );
+  CPPUNIT_ASSERT ( term == bold_reverse );
+  next = plain;
+  const std::string to_plain = oa.changeAttribute(term, next);
+  CPPUNIT_ASSERT ( ! to_plain.empty() );
+  CPPUNIT_ASSERT ( term == plain );
+  const finalcut::FChar term_state{term};
+
+  // Repeated transitions give the same sequences and states
+  for (auto i{0}; i < 3; i++)
+  {
+    next = colored;
+    CPPUNIT_ASSERT_STRING ( oa.changeAttribute(term, next), to_colored );
+    CPPUNIT_ASSERT ( term == colored );
+    CPPUNIT_ASSERT ( oa.changeAttribute(term, next).empty() );
+    next = bold_reverse;
+    CPPUNIT_ASSERT_STRING ( oa.changeAttribute(term, next), to_bold_reverse );
+    CPPUNIT_ASSERT ( term == bold_reverse );
+    next = plain;
+    CPPUNIT_ASSERT_STRING ( oa.changeAttribute(term, next), to_plain );
+    CPPUNIT_ASSERT ( term == term_state );
+  }
+
+  // A changed terminal environment discards the cached transitions
+  oa.set_a_foreground_color (CSI "38;5;%p1%dm");
+  oa.initialize();
+  next = colored;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(term, next)
+                        , CSI "38;5;7m" CSI "44m" );
+  CPPUNIT_ASSERT ( term == colored );
+
+  oa.unsetDefaultColorSupport();
+  next = plain;
+  CPPUNIT_ASSERT ( oa.changeAttribute(term, next) != to_plain );
+}
+
+//----------------------------------------------------------------------
+void FOptiAttrTest::directSGRTest()
+{
+  // Simulate an ECMA-48 conformant terminal with 256 colors
+
+  finalcut::FStartOptions::getInstance().sgr_optimizer = false;
+  finalcut::FOptiAttr oa;
+  oa.setDefaultColorSupport();  // ANSI default color
+  oa.setDirectSGRSupport();
+  oa.setMaxColor (256);
+  oa.setNoColorVideo (0);
+  oa.set_exit_attribute_mode (CSI "0m");
+  oa.set_enter_alt_charset_mode (ESC "(0");
+  oa.set_exit_alt_charset_mode (ESC "(B");
+  oa.set_a_foreground_color (CSI "%?%p1%{8}%<"
+                                 "%t3%p1%d"
+                                 "%e%p1%{16}%<"
+                                 "%t9%p1%{8}%-%d"
+                                 "%e38;5;%p1%d%;m");
+  oa.set_a_background_color (CSI "%?%p1%{8}%<"
+                                 "%t4%p1%d"
+                                 "%e%p1%{16}%<"
+                                 "%t10%p1%{8}%-%d"
+                                 "%e48;5;%p1%d%;m");
+  oa.set_orig_pair (CSI "39;49m");
+  oa.initialize();
+
+  finalcut::FChar from{};
+  finalcut::FChar to{};
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+
+  // Bold
+  to.attr.bit.bold = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "1m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // Blue text on white background + dim + italic
+  to.fg_color = finalcut::FColor::Blue;
+  to.bg_color = finalcut::FColor::White;
+  to.attr.bit.dim = true;
+  to.attr.bit.italic = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "2;3;34;107m" );
+  CPPUNIT_ASSERT ( from == to );
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+
+  // Reset attributes + default background (shorter than 22;23;49)
+  to.attr.bit.bold = false;
+  to.attr.bit.dim = false;
+  to.attr.bit.italic = false;
+  to.bg_color = finalcut::FColor::Default;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "0;34m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // 256 color text and background
+  to.fg_color = finalcut::FColor::SpringGreen3;
+  to.bg_color = finalcut::FColor::NavyBlue;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "38;5;42;48;5;17m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // Underline + reverse with default colors
+  to.fg_color = finalcut::FColor::Default;
+  to.bg_color = finalcut::FColor::Default;
+  to.attr.bit.underline = true;
+  to.attr.bit.reverse = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "4;7;39;49m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // Underline to double underline
+  to.attr.bit.underline = false;
+  to.attr.bit.dbl_underline = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "24;21m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // Standout looks like reverse
+  to.attr.bit.reverse = false;
+  to.attr.bit.standout = true;
+  CPPUNIT_ASSERT ( from != to );
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+  CPPUNIT_ASSERT ( from == to );
+
+  // The alternate character set is not part of SGR
+  to.attr.bit.alt_charset = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), ESC "(0" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // Everything off
+  to.attr.bit.standout = false;
+  to.attr.bit.dbl_underline = false;
+  to.attr.bit.alt_charset = false;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "0m" ESC "(B" );
+  CPPUNIT_ASSERT ( from == to );
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+
+  // Without direct SGR support, the termcap sequences are used
+  oa.unsetDirectSGRSupport();
+  to.fg_color = finalcut::FColor::Red;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "31m" );
+  CPPUNIT_ASSERT ( from == to );
+}
+
+//----------------------------------------------------------------------
+void FOptiAttrTest::trueColorTest()
+{
+  // Simulate an ECMA-48 conformant terminal with 24-bit colors
+
+  finalcut::FStartOptions::getInstance().sgr_optimizer = false;
+  finalcut::FOptiAttr oa;
+  oa.setDefaultColorSupport();  // ANSI default color
+  oa.setDirectSGRSupport();
+  oa.setTrueColorSupport();
+  oa.setMaxColor (256);
+  oa.setNoColorVideo (0);
+  oa.set_exit_attribute_mode (CSI "0m");
+  oa.set_a_foreground_color (CSI "%?%p1%{8}%<"
+                                 "%t3%p1%d"
+                                 "%e%p1%{16}%<"
+                                 "%t9%p1%{8}%-%d"
+                                 "%e38;5;%p1%d%;m");
+  oa.set_a_background_color (CSI "%?%p1%{8}%<"
+                                 "%t4%p1%d"
+                                 "%e%p1%{16}%<"
+                                 "%t10%p1%{8}%-%d"
+                                 "%e48;5;%p1%d%;m");
+  oa.set_orig_pair (CSI "39;49m");
+  oa.initialize();
+
+  finalcut::FChar from{};
+  finalcut::FChar to{};
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+
+  // RGB color values
+  const auto rgb = finalcut::rgb2Color(0x12, 0x34, 0x56);
+  CPPUNIT_ASSERT ( finalcut::isRGBColor(rgb) );
+  CPPUNIT_ASSERT ( ! finalcut::isRGBColor(finalcut::FColor::Grey93) );
+  CPPUNIT_ASSERT ( ! finalcut::isRGBColor(finalcut::FColor::Default) );
+  CPPUNIT_ASSERT ( ! finalcut::isRGBColor(finalcut::FColor::Undefined) );
+  CPPUNIT_ASSERT ( finalcut::getRedValue(rgb) == 0x12 );
+  CPPUNIT_ASSERT ( finalcut::getGreenValue(rgb) == 0x34 );
+  CPPUNIT_ASSERT ( finalcut::getBlueValue(rgb) == 0x56 );
+
+  // Direct SGR sequence
+  to.fg_color = rgb;
+  to.bg_color = finalcut::rgb2Color(0xff, 0x80, 0x00);
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "38;2;18;52;86;48;2;255;128;0m" );
+  CPPUNIT_ASSERT ( from == to );
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+
+  // Termcap based color change
+  oa.unsetDirectSGRSupport();
+  to.fg_color = finalcut::rgb2Color(1, 2, 3);
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "38;2;1;2;3m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // Quantization to the 256-color palette
+  oa.unsetTrueColorSupport();
+  to.fg_color = finalcut::rgb2Color(0xff, 0x87, 0x00);
+  to.bg_color = finalcut::rgb2Color(0x30, 0x30, 0x30);
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "38;5;208m" CSI "48;5;236m" );
+  CPPUNIT_ASSERT ( from.fg_color == finalcut::FColor::DarkOrange );
+  CPPUNIT_ASSERT ( from.bg_color == finalcut::FColor::Grey19 );
+  CPPUNIT_ASSERT ( from == to );
+  CPPUNIT_ASSERT ( oa.quantizeColor(finalcut::rgb2Color(0x80, 0x80, 0x80))
+                   == finalcut::FColor::Grey53 );
+  CPPUNIT_ASSERT ( oa.quantizeColor(finalcut::FColor::Red)
+                   == finalcut::FColor::Red );
+
+  // Quantization to the 16-color palette
+  oa.setMaxColor (16);
+  to.fg_color = finalcut::rgb2Color(0xf0, 0x10, 0x10);
+  to.bg_color = finalcut::rgb2Color(0x00, 0x00, 0xb0);
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "31m" CSI "44m" );
+  CPPUNIT_ASSERT ( from.fg_color == finalcut::FColor::Red );
+  CPPUNIT_ASSERT ( from.bg_color == finalcut::FColor::Blue );
+  CPPUNIT_ASSERT ( from == to );
+}
+
 //----------------------------------------------------------------------
 void FOptiAttrTest::ansiTest()
 {
@@ -1118,7 +1372,7 @@ void FOptiAttrTest::vt100Test()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017$<2>" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isInvisibleSimulated(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -2061,7 +2315,7 @@ void FOptiAttrTest::rxvtTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isInvisibleSimulated(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -2531,7 +2785,7 @@ void FOptiAttrTest::linuxTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isInvisibleSimulated(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -3006,7 +3260,7 @@ void FOptiAttrTest::puttyTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isInvisibleSimulated(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -3477,7 +3731,7 @@ void FOptiAttrTest::teratermTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017$<2>" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isInvisibleSimulated(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -3931,7 +4185,7 @@ void FOptiAttrTest::ibmColorTest()
   CPPUNIT_ASSERT ( from != to );
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), "" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isInvisibleSimulated(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -130,6 +130,7 @@ class FOptiMoveTest : public CPPUNIT_NS::TestFixture
     void noArgumentTest();
     void homeTest();
     void fromLeftToRightTest();
+    void parameterizedMoveTest();
     void ansiTest();
     void vt100Test();
     void xtermTest();
@@ -151,6 +152,7 @@ class FOptiMoveTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (noArgumentTest);
     CPPUNIT_TEST (homeTest);
     CPPUNIT_TEST (fromLeftToRightTest);
+    CPPUNIT_TEST (parameterizedMoveTest);
     CPPUNIT_TEST (ansiTest);
     CPPUNIT_TEST (vt100Test);
     CPPUNIT_TEST (xtermTest);
@@ -260,6 +262,38 @@ void FOptiMoveTest::fromLeftToRightTest()
   CPPUNIT_ASSERT_STRING (om.moveCursor (3, 2, 79, 2), "\r\b" ESC "D");
 }
 
+//----------------------------------------------------------------------
+void FOptiMoveTest::parameterizedMoveTest()
+{
+  int baud = 38400;
+  finalcut::FOptiMove om(baud);
+  om.setTermSize (200, 200);
+  om.set_carriage_return (nullptr);
+  om.set_cursor_down (nullptr);
+  om.set_cursor_address (nullptr);
+  om.set_parm_up_cursor (CSI "%p1%dA");
+  om.set_parm_down_cursor (CSI "%p1%dB");
+  om.set_parm_right_cursor (CSI "%p1%dC");
+  om.set_parm_left_cursor (CSI "%p1%dD");
+
+  // Precalculated sequences
+  CPPUNIT_ASSERT_STRING (om.moveCursor (5, 5, 5, 6), CSI "1B");
+  CPPUNIT_ASSERT_STRING (om.moveCursor (5, 5, 5, 68), CSI "63B");
+  CPPUNIT_ASSERT_STRING (om.moveCursor (10, 100, 73, 37), CSI "63A" CSI "63C");
+
+  // Distances outside the sequence table
+  CPPUNIT_ASSERT_STRING (om.moveCursor (5, 5, 5, 69), CSI "64B");
+  CPPUNIT_ASSERT_STRING (om.moveCursor (150, 5, 10, 5), CSI "140D");
+  CPPUNIT_ASSERT_STRING (om.moveCursor (10, 190, 199, 0), CSI "190A" CSI "189C");
+
+  // A changed capability replaces the precalculated sequences
+  om.set_parm_down_cursor (CSI "%p1%de");
+  CPPUNIT_ASSERT_STRING (om.moveCursor (5, 5, 5, 6), CSI "1e");
+  CPPUNIT_ASSERT_STRING (om.moveCursor (5, 5, 5, 105), CSI "100e");
+  om.set_parm_down_cursor (nullptr);
+  CPPUNIT_ASSERT (om.moveCursor (5, 5, 5, 6).empty());
+}
+
 //----------------------------------------------------------------------
 void FOptiMoveTest::ansiTest()
 {
@@ -106,6 +106,10 @@ static tcap_map tcap[] =
   { nullptr, "Ss" },  // set cursor style
   { nullptr, "sf" },  // scroll_forward
   { nullptr, "sr" },  // scroll_reverse
+  { nullptr, "cs" },  // change_scroll_region
+  { nullptr, "Lh" },  // enter_lr_margin_mode
+  { nullptr, "Lm" },  // set_lr_margins
+  { nullptr, "Ll" },  // exit_lr_margin_mode
   { nullptr, "ti" },  // enter_ca_mode
   { nullptr, "te" },  // exit_ca_mode
   { nullptr, "eA" },  // enable_acs
@@ -247,6 +251,13 @@ void FTermcapQuirksTest::generalTest()
                          , CSI "?47l" ESC "8" CSI "m" );
   CPPUNIT_ASSERT_CSTRING ( caps[int(finalcut::Termcap::t_cursor_address)].string
                          , CSI "%i%p1%d;%p2%dH" );
+  // No left and right margins without a DECLRMM mode report
+  CPPUNIT_ASSERT_CSTRING ( caps[int(finalcut::Termcap::t_enter_lr_margin_mode)].string
+                         , nullptr );
+  CPPUNIT_ASSERT_CSTRING ( caps[int(finalcut::Termcap::t_set_lr_margins)].string
+                         , nullptr );
+  CPPUNIT_ASSERT_CSTRING ( caps[int(finalcut::Termcap::t_exit_lr_margin_mode)].string
+                         , nullptr );
   // Non standard ECMA-48 (ANSI X3.64) terminal
   CPPUNIT_ASSERT_CSTRING ( caps[int(finalcut::Termcap::t_enter_dbl_underline_mode)].string
                          , nullptr );
@@ -34,6 +34,8 @@
 #undef row_address      // from term.h
 #undef tab              // from term.h
 
+#include <sys/select.h>
+
 #include <limits>
 #include <string>
 
@@ -71,6 +73,8 @@ class FSystemTest : public finalcut::FSystem
     auto pipe (finalcut::PipeData&) -> int override;
     auto open (const char*, int, ...) -> int override;
     auto close (int) -> int override;
+    auto write (int, const void*, std::size_t) -> ssize_t override;
+    auto select (int, fd_set*, fd_set*, fd_set*, struct timeval*) -> int override;
     auto fopen (const char*, const char*) -> FILE* override;
     auto fputs (const char*, FILE*) -> int override;
     auto fclose (FILE*) -> int override;
@@ -87,6 +91,12 @@ class FSystemTest : public finalcut::FSystem
     auto kevent ( int, const struct kevent*
                 , int, struct kevent*
                 , int, const struct timespec* ) -> int override;
+    auto timerfd_create (int, int) -> int override;
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override;
+    auto signalfd (int, const sigset_t*, int) -> int override;
+    auto pthread_sigmask (int, const sigset_t*, sigset_t*) -> int override;
     auto getuid() -> uid_t override;
     auto geteuid() -> uid_t override;
     auto getpwuid_r ( uid_t, struct passwd*, char*
@@ -248,6 +258,19 @@ auto FSystemTest::close (int file_descriptor) -> int
   return 0;
 }
 
+//----------------------------------------------------------------------
+auto FSystemTest::write (int fd, const void* buf, std::size_t count) -> ssize_t
+{
+  return ::write(fd, buf, count);
+}
+
+//----------------------------------------------------------------------
+auto FSystemTest::select ( int nfds, fd_set* readfds, fd_set* writefds
+                                 , fd_set* exceptfds, struct timeval* timeout ) -> int
+{
+  return ::select(nfds, readfds, writefds, exceptfds, timeout);
+}
+
 //----------------------------------------------------------------------
 auto FSystemTest::fopen (const char* path, const char* mode) -> FILE*
 {
@@ -321,6 +344,32 @@ auto FSystemTest::kevent ( int, const struct kevent*
   return 0;
 }
 
+//----------------------------------------------------------------------
+auto FSystemTest::timerfd_create (int, int) -> int
+{
+  return -1;
+}
+
+//----------------------------------------------------------------------
+auto FSystemTest::timerfd_settime ( int, int
+                                  , const struct itimerspec*
+                                  , struct itimerspec* ) -> int
+{
+  return 0;
+}
+
+//----------------------------------------------------------------------
+auto FSystemTest::signalfd (int, const sigset_t*, int) -> int
+{
+  return -1;
+}
+
+//----------------------------------------------------------------------
+auto FSystemTest::pthread_sigmask (int, const sigset_t*, sigset_t*) -> int
+{
+  return 0;
+}
+
 //----------------------------------------------------------------------
 auto FSystemTest::getuid() -> uid_t
 {
@@ -0,0 +1,923 @@
+/***********************************************************************
+* ftermoutput-test.cpp - FTermOutput unit tests                        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2026 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <sys/select.h>
+
+#include <cerrno>
+#include <clocale>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+#define CPPUNIT_ASSERT_STRING(expected, actual) \
+            check_string (expected, actual, CPPUNIT_SOURCELINE())
+
+//----------------------------------------------------------------------
+void check_string ( const std::string& s1
+                  , const std::string& s2
+                  , const CppUnit::SourceLine& sourceLine )
+{
+  if ( s1 == s2 )  // Strings are equal
+    return;
+
+  ::CppUnit::Asserter::fail ("Strings are not equal", sourceLine);
+}
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+struct var
+{
+  // Terminal encoding of FTermOutput (defined in ftermoutput.cpp)
+  static Encoding terminal_encoding;
+};
+
+}  // namespace internal
+
+}  // namespace finalcut
+
+
+namespace test
+{
+
+//----------------------------------------------------------------------
+// class FSystemTest
+//----------------------------------------------------------------------
+
+class FSystemTest : public finalcut::FSystem
+{
+  public:
+    // Constructor
+    FSystemTest() = default;
+
+    // Methods
+    auto inPortByte (uShort) -> uChar override
+    {
+      return 0;
+    }
+
+    void outPortByte (uChar, uShort) override
+    { }
+
+    auto isTTY (int) const -> int override
+    {
+      return 1;
+    }
+
+    auto ioctl (int, uLong, ...) -> int override
+    {
+      return -1;
+    }
+
+    auto pipe (finalcut::PipeData&) -> int override
+    {
+      return 0;
+    }
+
+    auto open (const char*, int, ...) -> int override
+    {
+      return 0;
+    }
+
+    auto close (int) -> int override
+    {
+      return 0;
+    }
+
+    auto write (int, const void* buf, std::size_t count) -> ssize_t override
+    {
+      write_calls++;
+
+      if ( interrupted_writes > 0 )
+      {
+        interrupted_writes--;
+        errno = EINTR;
+        return -1;
+      }
+
+      if ( blocked_writes > 0 )
+      {
+        blocked_writes--;
+        errno = EAGAIN;
+        return -1;
+      }
+
+      if ( write_error )
+      {
+        errno = EIO;
+        return -1;
+      }
+
+      if ( max_write_size > 0 && count > max_write_size )
+        count = max_write_size;
+
+      const std::string data(static_cast<const char*>(buf), count);
+      written_chunks.push_back(data);
+      characters.append(data);
+      return ssize_t(count);
+    }
+
+    auto select (int, fd_set*, fd_set*, fd_set*, struct timeval*) -> int override
+    {
+      select_calls++;
+      return 1;  // The terminal is writable
+    }
+
+    auto fopen (const char*, const char*) -> FILE* override
+    {
+      return nullptr;
+    }
+
+    auto fclose (FILE*) -> int override
+    {
+      return 0;
+    }
+
+    auto fputs (const char* str, FILE*) -> int override
+    {
+      const std::string string{str};
+      characters.append(string);
+      return int(string.length());
+    }
+
+    auto putchar (int c) -> int override
+    {
+      characters.push_back(char(c));
+      return c;
+    }
+
+    auto sigaction (int, const struct sigaction*, struct sigaction*) -> int override
+    {
+      return 0;
+    }
+
+    auto timer_create (clockid_t, struct sigevent*, timer_t*) -> int override
+    {
+      return 0;
+    }
+
+    auto timer_settime ( timer_t, int
+                       , const struct itimerspec*
+                       , struct itimerspec* ) -> int override
+    {
+      return 0;
+    }
+
+    auto timer_delete (timer_t) -> int override
+    {
+      return 0;
+    }
+
+    auto kqueue() -> int override
+    {
+      return 0;
+    }
+
+    auto kevent ( int, const struct kevent*
+                , int, struct kevent*
+                , int, const struct timespec* ) -> int override
+    {
+      return 0;
+    }
+
+    auto timerfd_create (int, int) -> int override
+    {
+      return -1;
+    }
+
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override
+    {
+      return 0;
+    }
+
+    auto signalfd (int, const sigset_t*, int) -> int override
+    {
+      return -1;
+    }
+
+    auto pthread_sigmask (int, const sigset_t*, sigset_t*) -> int override
+    {
+      return 0;
+    }
+
+    auto getuid() -> uid_t override
+    {
+      return 0;
+    }
+
+    auto geteuid() -> uid_t override
+    {
+      return 0;
+    }
+
+    auto getpwuid_r ( uid_t, struct passwd*, char*
+                    , size_t, struct passwd** ) -> int override
+    {
+      return 0;
+    }
+
+    auto realpath (const char*, char*) -> char* override
+    {
+      return const_cast<char*>("");
+    }
+
+    void clear()
+    {
+      characters.clear();
+      written_chunks.clear();
+      write_calls = 0;
+      select_calls = 0;
+    }
+
+    // Data members
+    std::string              characters{};      // All output characters
+    std::vector<std::string> written_chunks{};  // Data of each write()
+    std::size_t              write_calls{0};
+    std::size_t              select_calls{0};
+    std::size_t              max_write_size{0};  // 0 = unlimited
+    int                      interrupted_writes{0};
+    int                      blocked_writes{0};
+    bool                     write_error{false};
+};
+
+}  // namespace test
+
+
+//----------------------------------------------------------------------
+// class FTermOutputTest
+//----------------------------------------------------------------------
+
+class FTermOutputTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermOutputTest()
+    {
+      std::unique_ptr<finalcut::FSystem> fsys = std::make_unique<test::FSystemTest>();
+      finalcut::FTerm::setFSystem(fsys);
+      finalcut::FTermios::init();
+    }
+
+  protected:
+    void classNameTest();
+    void utf8EncodingTest();
+    void paddingSegmentTest();
+    void writeRetryTest();
+    void scrollRegionTest();
+    void synchronizedUpdateTest();
+    void unchangedSpansTest();
+    void repetitionTypeTest();
+    void erasureTypeTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermOutputTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (utf8EncodingTest);
+    CPPUNIT_TEST (paddingSegmentTest);
+    CPPUNIT_TEST (writeRetryTest);
+    CPPUNIT_TEST (scrollRegionTest);
+    CPPUNIT_TEST (synchronizedUpdateTest);
+    CPPUNIT_TEST (unchangedSpansTest);
+    CPPUNIT_TEST (repetitionTypeTest);
+    CPPUNIT_TEST (erasureTypeTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Method
+    static auto getFSystem() -> test::FSystemTest*;
+
+    // Data member
+    finalcut::FVTerm fvterm{};  // Needed for FVTerm::getFOutput()
+};
+
+//----------------------------------------------------------------------
+auto FTermOutputTest::getFSystem() -> test::FSystemTest*
+{
+  return static_cast<test::FSystemTest*>(finalcut::FSystem::getInstance().get());
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::classNameTest()
+{
+  const finalcut::FTermOutput output{fvterm};
+  const finalcut::FString& classname = output.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTermOutput" );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::utf8EncodingTest()
+{
+  finalcut::FTermOutput output{fvterm};
+  auto& buffer = output.output_buffer;
+
+  // 1 byte (7-bit)
+  output.appendUTF8Char (L'A');
+  CPPUNIT_ASSERT_STRING ( buffer, "A" );
+  buffer.clear();
+  output.appendUTF8Char (L'\U0000007f');
+  CPPUNIT_ASSERT_STRING ( buffer, "\x7f" );
+
+  // 2 bytes (11-bit)
+  buffer.clear();
+  output.appendUTF8Char (L'\U00000080');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xc2\x80" );
+  buffer.clear();
+  output.appendUTF8Char (L'ä');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xc3\xa4" );
+  buffer.clear();
+  output.appendUTF8Char (L'\U000007ff');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xdf\xbf" );
+
+  // 3 bytes (16-bit)
+  buffer.clear();
+  output.appendUTF8Char (L'\U00000800');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xe0\xa0\x80" );
+  buffer.clear();
+  output.appendUTF8Char (L'€');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xe2\x82\xac" );
+  buffer.clear();
+  output.appendUTF8Char (L'\U0000ffff');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xef\xbf\xbf" );
+
+  // 4 bytes (21-bit)
+  buffer.clear();
+  output.appendUTF8Char (L'\U00010000');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xf0\x90\x80\x80" );
+  buffer.clear();
+  output.appendUTF8Char (L'\U0001f600');
+  CPPUNIT_ASSERT_STRING ( buffer, "\xf0\x9f\x98\x80" );
+
+  // Characters outside the 21-bit range become U+FFFD
+  buffer.clear();
+  output.appendUTF8Char (wchar_t(0x200000));
+  CPPUNIT_ASSERT_STRING ( buffer, "\xef\xbf\xbd" );
+
+  // Successive characters are appended to the same buffer
+  buffer.clear();
+  output.appendUTF8Char (L'x');
+  output.appendUTF8Char (L'ÿ');
+  output.appendUTF8Char (L'→');
+  CPPUNIT_ASSERT_STRING ( buffer, "x\xc3\xbf\xe2\x86\x92" );
+  CPPUNIT_ASSERT ( output.padding_segments.empty() );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::paddingSegmentTest()
+{
+  using FTermControl = finalcut::FTermOutput::FTermControl;
+  auto fsys = getFSystem();
+  finalcut::FTermOutput output{fvterm};
+
+  // Without delay padding, the frame is written with a single write()
+  fsys->clear();
+  output.appendOutputBuffer (FTermControl{CSI "H"});
+  output.appendOutputBuffer (FTermControl{"text"});
+  CPPUNIT_ASSERT ( output.padding_segments.empty() );
+  output.flush();
+  CPPUNIT_ASSERT ( output.output_buffer.empty() );
+  CPPUNIT_ASSERT ( fsys->write_calls == 1 );
+  CPPUNIT_ASSERT ( fsys->written_chunks.size() == 1 );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[0], CSI "Htext" );
+  CPPUNIT_ASSERT_STRING ( fsys->characters, CSI "Htext" );
+
+  // Control strings with delay padding split the output buffer
+  fsys->clear();
+  output.time_last_flush = {};
+  output.appendOutputBuffer (FTermControl{"abc"});
+  output.appendOutputBuffer (FTermControl{CSI "2J$<5>"});
+  output.appendOutputBuffer (FTermControl{"def"});
+  output.appendOutputBuffer (FTermControl{ESC "M$<2>"});
+  output.appendOutputBuffer (FTermControl{"xyz"});
+  CPPUNIT_ASSERT ( output.padding_segments.size() == 2 );
+  CPPUNIT_ASSERT ( output.padding_segments[0].offset == 3 );
+  CPPUNIT_ASSERT ( output.padding_segments[0].length == 8 );
+  CPPUNIT_ASSERT ( output.padding_segments[1].offset == 14 );
+  CPPUNIT_ASSERT ( output.padding_segments[1].length == 6 );
+  output.flush();
+  CPPUNIT_ASSERT ( output.output_buffer.empty() );
+  CPPUNIT_ASSERT ( output.padding_segments.empty() );
+  // The text between the padded strings is written directly...
+  CPPUNIT_ASSERT ( fsys->written_chunks.size() == 3 );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[0], "abc" );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[1], "def" );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[2], "xyz" );
+  // ...while the padded strings are output via termcap in between
+  CPPUNIT_ASSERT_STRING ( fsys->characters, "abc" CSI "2Jdef" ESC "Mxyz" );
+
+  // A padded string at the buffer start and end gives no empty writes
+  fsys->clear();
+  output.time_last_flush = {};
+  output.appendOutputBuffer (FTermControl{CSI "2J$<5>"});
+  output.appendOutputBuffer (FTermControl{"123"});
+  output.appendOutputBuffer (FTermControl{CSI "2J$<5>"});
+  output.flush();
+  CPPUNIT_ASSERT ( fsys->written_chunks.size() == 1 );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[0], "123" );
+  CPPUNIT_ASSERT_STRING ( fsys->characters, CSI "2J123" CSI "2J" );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::writeRetryTest()
+{
+  const std::string data{"0123456789"};
+  auto fsys = getFSystem();
+  const finalcut::FTermOutput output{fvterm};
+
+  // Partial writes are continued with the remaining data
+  fsys->clear();
+  fsys->max_write_size = 4;
+  output.writeOutputBuffer (data.data(), data.length());
+  CPPUNIT_ASSERT ( fsys->write_calls == 3 );
+  CPPUNIT_ASSERT ( fsys->written_chunks.size() == 3 );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[0], "0123" );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[1], "4567" );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[2], "89" );
+  CPPUNIT_ASSERT_STRING ( fsys->characters, data );
+
+  // Interrupted writes are repeated
+  fsys->clear();
+  fsys->max_write_size = 0;
+  fsys->interrupted_writes = 2;
+  output.writeOutputBuffer (data.data(), data.length());
+  CPPUNIT_ASSERT ( fsys->write_calls == 3 );
+  CPPUNIT_ASSERT ( fsys->select_calls == 0 );
+  CPPUNIT_ASSERT_STRING ( fsys->characters, data );
+
+  // EAGAIN waits until the terminal is writable and then retries
+  fsys->clear();
+  fsys->max_write_size = 6;
+  fsys->blocked_writes = 2;
+  output.writeOutputBuffer (data.data(), data.length());
+  CPPUNIT_ASSERT ( fsys->write_calls == 4 );
+  CPPUNIT_ASSERT ( fsys->select_calls == 2 );
+  CPPUNIT_ASSERT ( fsys->written_chunks.size() == 2 );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[0], "012345" );
+  CPPUNIT_ASSERT_STRING ( fsys->written_chunks[1], "6789" );
+  CPPUNIT_ASSERT_STRING ( fsys->characters, data );
+
+  // Any other error cancels the output
+  fsys->clear();
+  fsys->max_write_size = 0;
+  fsys->write_error = true;
+  output.writeOutputBuffer (data.data(), data.length());
+  CPPUNIT_ASSERT ( fsys->write_calls == 1 );
+  CPPUNIT_ASSERT ( fsys->characters.empty() );
+  fsys->write_error = false;
+
+  // Nothing is written for empty data
+  fsys->clear();
+  output.writeOutputBuffer (data.data(), 0);
+  CPPUNIT_ASSERT ( fsys->write_calls == 0 );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::scrollRegionTest()
+{
+  using finalcut::Termcap;
+  using finalcut::FPoint;
+  using finalcut::FRect;
+  auto& caps = finalcut::FTermcap::strings;
+  finalcut::FTermOutput output{fvterm};
+  finalcut::FVTerm::FTermArea term_area{};
+  term_area.size.width = 80;
+  term_area.size.height = 24;
+  output.vterm = &term_area;
+  output.term_pos = std::make_shared<FPoint>(0, 0);
+  auto& buffer = output.output_buffer;
+  const FRect full_width{FPoint{0, 5}, FPoint{79, 10}};
+  const FRect with_margins{FPoint{10, 5}, FPoint{49, 10}};
+
+  // Without a change_scroll_region string, nothing can be scrolled
+  caps[int(Termcap::t_change_scroll_region)].string = nullptr;
+  caps[int(Termcap::t_enter_lr_margin_mode)].string = nullptr;
+  caps[int(Termcap::t_set_lr_margins)].string = nullptr;
+  caps[int(Termcap::t_exit_lr_margin_mode)].string = nullptr;
+  CPPUNIT_ASSERT ( ! output.canScrollTerminalRegion(full_width) );
+
+  // Without left and right margins, only the full width can be scrolled
+  caps[int(Termcap::t_change_scroll_region)].string = CSI "%i%p1%d;%p2%dr";
+  CPPUNIT_ASSERT ( output.canScrollTerminalRegion(full_width) );
+  CPPUNIT_ASSERT ( ! output.canScrollTerminalRegion(with_margins) );
+  CPPUNIT_ASSERT ( ! output.canScrollTerminalRegion(FRect{FPoint{0, 5}, FPoint{79, 5}}) );
+  output.setScrollRegion (full_width);
+  CPPUNIT_ASSERT_STRING ( buffer, CSI "6;11r" );
+  CPPUNIT_ASSERT ( *output.term_pos == FPoint(-1, -1) );
+  buffer.clear();
+  output.resetScrollRegion (full_width);
+  CPPUNIT_ASSERT_STRING ( buffer, CSI "1;24r" );
+
+  // The margins are set with the termcap strings from FTermcapQuirks
+  caps[int(Termcap::t_enter_lr_margin_mode)].string = CSI "?69h";
+  caps[int(Termcap::t_set_lr_margins)].string = CSI "%i%p1%d;%p2%ds";
+  CPPUNIT_ASSERT ( ! output.canScrollTerminalRegion(with_margins) );
+  caps[int(Termcap::t_exit_lr_margin_mode)].string = CSI "?69l";
+  CPPUNIT_ASSERT ( output.canScrollTerminalRegion(with_margins) );
+  buffer.clear();
+  output.setScrollRegion (with_margins);
+  CPPUNIT_ASSERT_STRING ( buffer, CSI "6;11r" CSI "?69h" CSI "11;50s" );
+  buffer.clear();
+  output.resetScrollRegion (with_margins);
+  CPPUNIT_ASSERT_STRING ( buffer, CSI "?69l" CSI "1;24r" );
+
+  // The full width does not need the margin mode
+  buffer.clear();
+  output.setScrollRegion (full_width);
+  output.resetScrollRegion (full_width);
+  CPPUNIT_ASSERT_STRING ( buffer, CSI "6;11r" CSI "1;24r" );
+
+  // The scrolling starts the synchronized update of the next frame
+  caps[int(Termcap::t_scroll_forward)].string = ESC "D";
+  output.sync_update_support = true;
+  buffer.clear();
+  CPPUNIT_ASSERT ( output.scrollTerminalRegionForward(full_width) );
+  CPPUNIT_ASSERT ( output.sync_update_active );
+  CPPUNIT_ASSERT ( buffer.compare(0, 8, CSI "?2026h") == 0 );
+  output.endSynchronizedUpdate();
+  CPPUNIT_ASSERT ( buffer.compare(buffer.size() - 8, 8, CSI "?2026l") == 0 );
+  output.sync_update_support = false;
+
+  caps[int(Termcap::t_scroll_forward)].string = nullptr;
+  caps[int(Termcap::t_change_scroll_region)].string = nullptr;
+  caps[int(Termcap::t_enter_lr_margin_mode)].string = nullptr;
+  caps[int(Termcap::t_set_lr_margins)].string = nullptr;
+  caps[int(Termcap::t_exit_lr_margin_mode)].string = nullptr;
+  output.vterm = nullptr;
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::synchronizedUpdateTest()
+{
+  using FTermControl = finalcut::FTermOutput::FTermControl;
+  auto fsys = getFSystem();
+  finalcut::FTermOutput output{fvterm};
+  auto& buffer = output.output_buffer;
+
+  // Without terminal support, no synchronized output is used
+  output.beginSynchronizedUpdate();
+  CPPUNIT_ASSERT ( buffer.empty() );
+  CPPUNIT_ASSERT ( ! output.sync_update_active );
+
+  // An update without output leaves no sequences in the buffer
+  output.sync_update_support = true;
+  output.beginSynchronizedUpdate();
+  CPPUNIT_ASSERT_STRING ( buffer, CSI "?2026h" );
+  CPPUNIT_ASSERT ( output.sync_update_active );
+  output.endSynchronizedUpdate();
+  CPPUNIT_ASSERT ( buffer.empty() );
+  CPPUNIT_ASSERT ( ! output.sync_update_active );
+
+  // A flush during the frame keeps the update open
+  fsys->clear();
+  output.beginSynchronizedUpdate();
+  output.appendOutputBuffer (FTermControl{"abc"});
+  output.time_last_flush = {};
+  output.flush();
+  CPPUNIT_ASSERT ( buffer.empty() );
+  CPPUNIT_ASSERT ( output.sync_update_active );
+  CPPUNIT_ASSERT_STRING ( fsys->characters, CSI "?2026habc" );
+
+  // The end of the frame closes the update
+  output.appendOutputBuffer (FTermControl{"def"});
+  output.endSynchronizedUpdate();
+  CPPUNIT_ASSERT ( ! output.sync_update_active );
+  output.time_last_flush = {};
+  output.flush();
+  CPPUNIT_ASSERT_STRING ( fsys->characters, CSI "?2026habcdef" CSI "?2026l" );
+
+  // Nothing was output after the flush, but the open
+  // update must still be closed
+  fsys->clear();
+  output.beginSynchronizedUpdate();
+  output.time_last_flush = {};
+  output.flush();
+  output.endSynchronizedUpdate();
+  output.time_last_flush = {};
+  output.flush();
+  CPPUNIT_ASSERT_STRING ( fsys->characters, CSI "?2026h" CSI "?2026l" );
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::unchangedSpansTest()
+{
+  using CharSpan = finalcut::FTermOutput::CharSpan;
+  finalcut::FTermOutput output{fvterm};
+  finalcut::FVTerm::FTermArea term_area{};
+  term_area.size.width = 200;
+  term_area.size.height = 2;
+  term_area.data.resize(400);
+  output.vterm = &term_area;
+  const auto& spans = output.unchanged_spans;
+
+  auto set_no_changes = [&term_area] (int x1, int x2)
+  {
+    for (auto x{x1}; x <= x2; x++)
+      term_area.getFChar(x, 1).attr.bit.no_changes = true;
+  };
+
+  auto check_spans = [&output, &spans, &term_area] (uInt xmin, uInt xmax)
+  {
+    // Compare the result with a character by character search
+    std::vector<CharSpan> expected{};
+    output.findUnchangedSpans (xmin, xmax, 1);
+
+    for (auto x{xmin}; x <= xmax; x++)
+    {
+      if ( ! term_area.getFChar(int(x), 1).attr.bit.no_changes )
+        continue;
+
+      if ( ! expected.empty() && expected.back().end + 1 == x )
+        expected.back().end = x;
+      else
+        expected.push_back({x, x});
+    }
+
+    CPPUNIT_ASSERT ( spans.size() == expected.size() );
+
+    for (std::size_t i{0}; i < spans.size(); i++)
+    {
+      CPPUNIT_ASSERT ( spans[i].start == expected[i].start );
+      CPPUNIT_ASSERT ( spans[i].end == expected[i].end );
+    }
+  };
+
+  // No unchanged characters
+  output.findUnchangedSpans (0, 199, 1);
+  CPPUNIT_ASSERT ( spans.empty() );
+
+  // Spans across the 64 character block boundaries
+  set_no_changes (60, 67);
+  set_no_changes (100, 140);
+  set_no_changes (191, 192);
+  output.findUnchangedSpans (0, 199, 1);
+  CPPUNIT_ASSERT ( spans.size() == 3 );
+  CPPUNIT_ASSERT ( spans[0].start == 60 );
+  CPPUNIT_ASSERT ( spans[0].end == 67 );
+  CPPUNIT_ASSERT ( spans[1].start == 100 );
+  CPPUNIT_ASSERT ( spans[1].end == 140 );
+  CPPUNIT_ASSERT ( spans[2].start == 191 );
+  CPPUNIT_ASSERT ( spans[2].end == 192 );
+
+  // The block boundaries move with xmin
+  output.findUnchangedSpans (4, 190, 1);
+  CPPUNIT_ASSERT ( spans.size() == 2 );
+  CPPUNIT_ASSERT ( spans[0].start == 60 );
+  CPPUNIT_ASSERT ( spans[1].end == 140 );
+
+  // A span that ends in the partial trailing block
+  set_no_changes (195, 199);
+  output.findUnchangedSpans (5, 197, 1);
+  CPPUNIT_ASSERT ( spans.size() == 4 );
+  CPPUNIT_ASSERT ( spans[3].start == 195 );
+  CPPUNIT_ASSERT ( spans[3].end == 197 );
+
+  // A span that fills a whole block and continues in the next one
+  set_no_changes (0, 59);
+  output.findUnchangedSpans (0, 127, 1);
+  CPPUNIT_ASSERT ( spans.size() == 2 );
+  CPPUNIT_ASSERT ( spans[0].start == 0 );
+  CPPUNIT_ASSERT ( spans[0].end == 67 );
+  CPPUNIT_ASSERT ( spans[1].start == 100 );
+  CPPUNIT_ASSERT ( spans[1].end == 127 );
+
+  // Ranges with exact and partial blocks of all lengths
+  for (const uInt xmin : {0U, 1U, 37U, 63U, 64U, 65U, 128U})
+    for (auto xmax{xmin}; xmax < 200; xmax++)
+      check_spans (xmin, xmax);
+
+  // The first row is not affected
+  output.findUnchangedSpans (0, 199, 0);
+  CPPUNIT_ASSERT ( spans.empty() );
+  output.vterm = nullptr;
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::repetitionTypeTest()
+{
+  using finalcut::Termcap;
+  using Repetition = finalcut::FTermOutput::Repetition;
+  auto& caps = finalcut::FTermcap::strings;
+  auto& encoding = finalcut::internal::var::terminal_encoding;
+  const auto saved_encoding = encoding;
+  const std::string saved_locale{std::setlocale(LC_CTYPE, nullptr)};
+  std::setlocale (LC_CTYPE, "C.UTF-8");  // iswprint() for non-ASCII
+  finalcut::FTermOutput output{fvterm};
+  finalcut::FChar ascii_char{};
+  ascii_char.ch[0] = L'a';
+  finalcut::FChar latin_char{};
+  latin_char.ch[0] = L'ä';  // 2 bytes in UTF-8
+  uInt cost{};
+
+  // Without termcap strings, every character is printed
+  caps[int(Termcap::t_repeat_char)].string = nullptr;
+  caps[int(Termcap::t_repeat_last_char)].string = nullptr;
+  output.init_parameterLengths();
+  encoding = finalcut::Encoding::UTF8;
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 20, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 20 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(latin_char, 20, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 40 );
+
+  // rep ("a" CSI "4b" = 5 bytes) only pays off from 6 characters
+  caps[int(Termcap::t_repeat_char)].string = "%p1%c" CSI "%p2%{1}%-%db";
+  output.init_parameterLengths();
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 3, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 3 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 5, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 5 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 6, cost)
+                   == Repetition::ASCII );
+  CPPUNIT_ASSERT ( cost == 5 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 11, cost)
+                   == Repetition::ASCII );
+  CPPUNIT_ASSERT ( cost == 6 );
+
+  // rep can only repeat 7-bit characters
+  CPPUNIT_ASSERT ( output.getRepetitionType(latin_char, 20, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 40 );
+
+  // REP (CSI "3b" = 4 bytes) follows the printed character
+  caps[int(Termcap::t_repeat_last_char)].string = CSI "%p1%{1}%-%db";
+  output.init_parameterLengths();
+  CPPUNIT_ASSERT ( output.getRepetitionType(latin_char, 3, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 6 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(latin_char, 4, cost)
+                   == Repetition::UTF8 );
+  CPPUNIT_ASSERT ( cost == 6 );
+
+  // With the same length, rep is preferred over REP
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 6, cost)
+                   == Repetition::ASCII );
+  CPPUNIT_ASSERT ( cost == 5 );
+
+  // Without rep, REP is used for 7-bit characters too
+  caps[int(Termcap::t_repeat_char)].string = nullptr;
+  output.init_parameterLengths();
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 5, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 5 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 6, cost)
+                   == Repetition::UTF8 );
+  CPPUNIT_ASSERT ( cost == 5 );
+
+  // Every character has one byte without UTF-8
+  encoding = finalcut::Encoding::VT100;
+  CPPUNIT_ASSERT ( output.getRepetitionType(latin_char, 5, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 5 );
+  CPPUNIT_ASSERT ( output.getRepetitionType(latin_char, 6, cost)
+                   == Repetition::UTF8 );
+  CPPUNIT_ASSERT ( cost == 5 );
+
+  // A character with combining characters cannot be repeated
+  encoding = finalcut::Encoding::UTF8;
+  ascii_char.ch[1] = L'\U00000300';
+  CPPUNIT_ASSERT ( output.getRepetitionType(ascii_char, 20, cost)
+                   == Repetition::NotOptimized );
+  CPPUNIT_ASSERT ( cost == 20 );
+
+  caps[int(Termcap::t_repeat_last_char)].string = nullptr;
+  encoding = saved_encoding;
+  std::setlocale (LC_CTYPE, saved_locale.c_str());
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::erasureTypeTest()
+{
+  using finalcut::Termcap;
+  using Erasure = finalcut::FTermOutput::Erasure;
+  auto& caps = finalcut::FTermcap::strings;
+  auto& ut = finalcut::FTermcap::background_color_erase;
+  const auto saved_ut = ut;
+  finalcut::FTermOutput output{fvterm};
+  finalcut::FVTerm::FTermArea term_area{};
+  term_area.size.width = 80;
+  term_area.size.height = 24;
+  output.vterm = &term_area;
+  output.clr_eol_length = 3;  // CSI "K"
+  output.cursor_address_length = 7;  // CSI "1;21H"
+  finalcut::FChar space{};
+  space.ch[0] = L' ';
+  space.fg_color = finalcut::FColor::Default;
+  space.bg_color = finalcut::FColor::Default;
+
+  // The cursor is moved behind the erased characters
+  caps[int(Termcap::t_erase_chars)].string = nullptr;
+  caps[int(Termcap::t_clr_eol)].string = nullptr;
+  output.init_parameterLengths();
+  ut = false;
+
+  // Without termcap strings, nothing can be erased
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 29}, 20)
+                   == Erasure::NotOptimized );
+
+  // ech (CSI "12X" = 5 bytes) plus cursor motion
+  // pays off from 13 characters
+  caps[int(Termcap::t_erase_chars)].string = CSI "%p1%dX";
+  output.init_parameterLengths();
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 21}, 12)
+                   == Erasure::NotOptimized );
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 22}, 13)
+                   == Erasure::EraseCharacters );
+
+  // A shorter rep sequence beats ech
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 22}, 6)
+                   == Erasure::NotOptimized );
+
+  // Short runs are always printed
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 12}, 3)
+                   == Erasure::NotOptimized );
+
+  // No cursor motion is needed at the end of the line
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::EraseCharacters );
+
+  // el (3 bytes) is shorter than ech at the end of the line
+  caps[int(Termcap::t_clr_eol)].string = CSI "K";
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::ClearToEOL );
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 22}, 13)
+                   == Erasure::EraseCharacters );
+
+  // Without back_color_erase (ut), a background color
+  // cannot be erased
+  space.bg_color = finalcut::FColor::Blue;
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 22}, 13)
+                   == Erasure::NotOptimized );
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::NotOptimized );
+
+  ut = true;
+  CPPUNIT_ASSERT ( output.getErasureType(space, {10, 22}, 13)
+                   == Erasure::EraseCharacters );
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::ClearToEOL );
+
+  // Erasing does not transfer attributes that are
+  // visible on a blank cell
+  space.attr.bit.underline = true;
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::NotOptimized );
+  space.attr.bit.underline = false;
+  space.attr.bit.reverse = true;
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::NotOptimized );
+  space.attr.bit.reverse = false;
+  space.attr.bit.bold = true;
+  CPPUNIT_ASSERT ( output.getErasureType(space, {74, 79}, 6)
+                   == Erasure::ClearToEOL );
+
+  caps[int(Termcap::t_erase_chars)].string = nullptr;
+  caps[int(Termcap::t_clr_eol)].string = nullptr;
+  ut = saved_ut;
+  output.vterm = nullptr;
+}
+
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermOutputTest);
+
+// The general unit test main part
+#include <main-test.inc>
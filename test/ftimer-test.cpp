@@ -22,6 +22,7 @@
 
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -63,15 +64,18 @@ class FTimer_protected : public finalcut::FObjectTimer
       return finalcut::FObjectTimer::processTimerEvent();
     }
 
-    void performTimerAction (finalcut::FObject*, finalcut::FEvent*) override
+    void performTimerAction (finalcut::FObject*, finalcut::FEvent* event) override
     {
       std::cout << ".";
       fflush(stdout);
       count++;
+      const auto timer_event = static_cast<finalcut::FTimerEvent*>(event);
+      fired_ids.push_back(timer_event->getTimerId());
     }
 
-    // Data member
-    uInt count{0};
+    // Data members
+    uInt             count{0};
+    std::vector<int> fired_ids{};
 };
 
 //----------------------------------------------------------------------
@@ -115,6 +119,7 @@ class FTimerTest : public CPPUNIT_NS::TestFixture
     void timeTest();
     void timerTest();
     void performTimerActionTest();
+    void nextTimeoutTest();
 
   private:
     // Adds code needed to register the test suite
@@ -125,6 +130,7 @@ class FTimerTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (timeTest);
     CPPUNIT_TEST (timerTest);
     CPPUNIT_TEST (performTimerActionTest);
+    CPPUNIT_TEST (nextTimeoutTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -306,6 +312,62 @@ void FTimerTest::performTimerActionTest()
   CPPUNIT_ASSERT ( t2.getValue() == 10 );
 }
 
+//----------------------------------------------------------------------
+void FTimerTest::nextTimeoutTest()
+{
+  using std::chrono::milliseconds;
+  using std::chrono::steady_clock;
+  using finalcut::FObjectTimer;
+
+  test::FTimer_protected t1;
+  t1.delAllTimers();
+  CPPUNIT_ASSERT ( FObjectTimer::getTimeUntilNextTimeout()
+                   == steady_clock::duration::max() );
+
+  const int id_a = t1.addTimer(300);
+  const int id_b = t1.addTimer(50);
+  const int id_c = t1.addTimer(200);
+  CPPUNIT_ASSERT ( t1.getTimerList()->size() == 3 );
+
+  // The earliest deadline is always at the top
+  auto time_left = FObjectTimer::getTimeUntilNextTimeout();
+  CPPUNIT_ASSERT ( time_left > milliseconds(0) );
+  CPPUNIT_ASSERT ( time_left <= milliseconds(50) );
+
+  CPPUNIT_ASSERT ( t1.delTimer(id_b) );
+  time_left = FObjectTimer::getTimeUntilNextTimeout();
+  CPPUNIT_ASSERT ( time_left > milliseconds(50) );
+  CPPUNIT_ASSERT ( time_left <= milliseconds(200) );
+
+  CPPUNIT_ASSERT ( t1.delTimer(id_c) );
+  CPPUNIT_ASSERT ( ! t1.delTimer(id_c) );
+  time_left = FObjectTimer::getTimeUntilNextTimeout();
+  CPPUNIT_ASSERT ( time_left > milliseconds(200) );
+  CPPUNIT_ASSERT ( time_left <= milliseconds(300) );
+
+  CPPUNIT_ASSERT ( t1.delTimer(id_a) );
+  CPPUNIT_ASSERT ( t1.getTimerList()->empty() );
+
+  // Expired timers fire in deadline order and are re-armed
+  const int id_slow = t1.addTimer(30);
+  const int id_fast = t1.addTimer(10);
+  std::this_thread::sleep_for(milliseconds(40));
+  CPPUNIT_ASSERT ( t1.processEvent() == 2 );
+  CPPUNIT_ASSERT ( t1.fired_ids.size() == 2 );
+  CPPUNIT_ASSERT ( t1.fired_ids[0] == id_fast );
+  CPPUNIT_ASSERT ( t1.fired_ids[1] == id_slow );
+  CPPUNIT_ASSERT ( t1.getTimerList()->size() == 2 );
+
+  // A timer fires at most once per call
+  CPPUNIT_ASSERT ( t1.processEvent() == 0 );
+  time_left = FObjectTimer::getTimeUntilNextTimeout();
+  CPPUNIT_ASSERT ( time_left > milliseconds(0) );
+  CPPUNIT_ASSERT ( time_left <= milliseconds(10) );
+
+  CPPUNIT_ASSERT ( t1.delOwnTimers() );
+  CPPUNIT_ASSERT ( t1.getTimerList()->empty() );
+}
+
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FTimerTest);
 
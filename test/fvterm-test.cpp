@@ -21,6 +21,7 @@
 ***********************************************************************/
 
 #include <queue>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -70,12 +71,14 @@ class FTermOutputTest : public finalcut::FOutput
     // Accessors
     auto getClassName() const -> finalcut::FString override;
     auto getFTerm() & -> finalcut::FTerm&;
+    static auto getScrollRegions() -> std::vector<finalcut::FRect>&;
     auto getColumnNumber() const -> std::size_t override;
     auto getLineNumber() const -> std::size_t override;
     auto getTabstop() const -> int override;
     auto getMaxColor() const -> int override;
     auto getEncoding() const -> finalcut::Encoding override;
     auto getKeyName (finalcut::FKey) const -> finalcut::FString override;
+    auto getTargetFrameRate() const -> uInt override;
 
     // Mutators
     void setCursor (finalcut::FPoint) override;
@@ -86,7 +89,9 @@ class FTermOutputTest : public finalcut::FOutput
     auto setVGAFont() -> bool override;
     auto setNewFont() -> bool override;
     void setNonBlockingRead (bool = true) override;
+    void setTargetFrameRate (uInt) override;
     static void setNoForce (bool = true);
+    static void setFrameDue (bool = true);
 
     // Inquiries
     auto isCursorHideable() const -> bool override;
@@ -110,6 +115,8 @@ class FTermOutputTest : public finalcut::FOutput
     void initScreenSettings() override;
     auto scrollTerminalForward() -> bool override;
     auto scrollTerminalReverse() -> bool override;
+    auto scrollTerminalRegionForward (const finalcut::FRect&) -> bool override;
+    auto scrollTerminalRegionReverse (const finalcut::FRect&) -> bool override;
     void clearTerminalAttributes() override;
     void clearTerminalState() override;
     auto clearTerminal (wchar_t = L' ') -> bool override;
@@ -132,6 +139,9 @@ class FTermOutputTest : public finalcut::FOutput
     // Data member
     bool                                 bell{false};
     static bool                          no_force;
+    static bool                          frame_due;
+    static std::vector<finalcut::FRect>  scroll_regions;
+    uInt                                 frame_rate{0};
     finalcut::FTerm                      fterm{};
     static finalcut::FVTerm::FTermArea*  vterm;
     static finalcut::FTermData*          fterm_data;
@@ -143,6 +153,8 @@ class FTermOutputTest : public finalcut::FOutput
 
 // static class attributes
 bool                         FTermOutputTest::no_force{false};
+bool                         FTermOutputTest::frame_due{true};
+std::vector<finalcut::FRect> FTermOutputTest::scroll_regions{};
 finalcut::FVTerm::FTermArea* FTermOutputTest::vterm{nullptr};
 finalcut::FTermData*         FTermOutputTest::fterm_data{nullptr};
 
@@ -164,6 +176,12 @@ inline auto FTermOutputTest::getClassName() const -> finalcut::FString
   return "FTermOutputTest";
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::getScrollRegions() -> std::vector<finalcut::FRect>&
+{
+  return scroll_regions;
+}
+
 //----------------------------------------------------------------------
 inline auto FTermOutputTest::getColumnNumber() const -> std::size_t
 {
@@ -202,6 +220,12 @@ inline auto FTermOutputTest::getKeyName (finalcut::FKey keynum) const -> finalcu
   return keyboard.getKeyName (keynum);
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::getTargetFrameRate() const -> uInt
+{
+  return frame_rate;
+}
+
 //----------------------------------------------------------------------
 inline auto FTermOutputTest::isCursorHideable() const -> bool
 {
@@ -229,7 +253,7 @@ inline auto FTermOutputTest::isEncodable (const wchar_t&) const -> bool
 //----------------------------------------------------------------------
 inline auto FTermOutputTest::isFlushTimeout() const -> bool
 {
-  return true;
+  return frame_due;
 }
 
 //----------------------------------------------------------------------
@@ -309,12 +333,24 @@ inline void FTermOutputTest::setNonBlockingRead (bool enable)
   finalcut::FKeyboard::setReadBlockingTime (blocking_time);
 }
 
+//----------------------------------------------------------------------
+inline void FTermOutputTest::setTargetFrameRate (uInt fps)
+{
+  frame_rate = fps;
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutputTest::setNoForce (bool state)
 {
   no_force = state;
 }
 
+//----------------------------------------------------------------------
+inline void FTermOutputTest::setFrameDue (bool state)
+{
+  frame_due = state;
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutputTest::initTerminal (finalcut::FVTerm::FTermArea* virtual_terminal)
 {
@@ -368,6 +404,20 @@ inline auto FTermOutputTest::scrollTerminalReverse() -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::scrollTerminalRegionForward (const finalcut::FRect& region) -> bool
+{
+  scroll_regions.push_back(region);
+  return false;
+}
+
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::scrollTerminalRegionReverse (const finalcut::FRect& region) -> bool
+{
+  scroll_regions.push_back(region);
+  return false;
+}
+
 //----------------------------------------------------------------------
 inline void FTermOutputTest::clearTerminalAttributes()
 {
@@ -783,7 +833,14 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     void FVTermPrintTest();
     void FVTermChildAreaPrintTest();
     void FVTermScrollTest();
+    void FVTermScrollRegionTest();
     void FVTermOverlappingWindowsTest();
+    void FVTermOcclusionTest();
+    void FVTermLineSpansTest();
+    void FVTermTransparentStackTest();
+    void FVTermDirtyWindowTest();
+    void FVTermBandCompositingTest();
+    void FVTermFramePacingTest();
     void FVTermReduceUpdatesTest();
     void getFVTermAreaTest();
 
@@ -799,7 +856,14 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (FVTermPrintTest);
     CPPUNIT_TEST (FVTermChildAreaPrintTest);
     CPPUNIT_TEST (FVTermScrollTest);
+    CPPUNIT_TEST (FVTermScrollRegionTest);
     CPPUNIT_TEST (FVTermOverlappingWindowsTest);
+    CPPUNIT_TEST (FVTermOcclusionTest);
+    CPPUNIT_TEST (FVTermLineSpansTest);
+    CPPUNIT_TEST (FVTermTransparentStackTest);
+    CPPUNIT_TEST (FVTermDirtyWindowTest);
+    CPPUNIT_TEST (FVTermBandCompositingTest);
+    CPPUNIT_TEST (FVTermFramePacingTest);
     CPPUNIT_TEST (FVTermReduceUpdatesTest);
     CPPUNIT_TEST (getFVTermAreaTest);
 
@@ -854,7 +918,6 @@ void FVTermTest::OwnFunctionsTest()
 {
   finalcut::FChar shadow_char;
   shadow_char.ch           = { L'\0', L'\0', L'\0', L'\0', L'\0' };
-  shadow_char.encoded_char = { L'\0', L'\0', L'\0', L'\0', L'\0' };
   shadow_char.fg_color     = finalcut::FColor::Default;
   shadow_char.bg_color     = finalcut::FColor::Default;
   shadow_char.attr.byte[0] = 0;
@@ -866,7 +929,6 @@ void FVTermTest::OwnFunctionsTest()
   // FChar struct
   finalcut::FChar test_char =
   {
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
@@ -950,8 +1012,8 @@ void FVTermTest::FVTermBasesTest()
 
   if ( &(vwin->changes[0]) )
   {
-    CPPUNIT_ASSERT ( vwin->changes[0].xmin == 22 );
-    CPPUNIT_ASSERT ( vwin->changes[0].xmax == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[0].getXmin() == 22 );
+    CPPUNIT_ASSERT ( vwin->changes[0].getXmax() == 0 );
     CPPUNIT_ASSERT ( vwin->changes[0].trans_count == 0 );
   }
 
@@ -995,7 +1057,6 @@ void FVTermTest::FVTermBasesTest()
 
   finalcut::FChar default_char;
   default_char.ch           = { L' ', L'\0', L'\0', L'\0', L'\0' };
-  default_char.encoded_char = { L'\0', L'\0', L'\0', L'\0', L'\0' };
   default_char.fg_color     = finalcut::FColor::Default;
   default_char.bg_color     = finalcut::FColor::Default;
   default_char.attr.byte[0] = 0;
@@ -1063,8 +1124,8 @@ void FVTermTest::FVTermBasesTest()
   CPPUNIT_ASSERT ( ! vdesktop->minimized );
   CPPUNIT_ASSERT ( vdesktop->preproc_list.empty() );
   CPPUNIT_ASSERT ( ! vdesktop->changes.empty() );
-  CPPUNIT_ASSERT ( vdesktop->changes[0].xmin == 80 );
-  CPPUNIT_ASSERT ( vdesktop->changes[0].xmax == 0 );
+  CPPUNIT_ASSERT ( vdesktop->changes[0].getXmin() == 80 );
+  CPPUNIT_ASSERT ( vdesktop->changes[0].getXmax() == 0 );
   CPPUNIT_ASSERT ( vdesktop->changes[0].trans_count == 0 );
   CPPUNIT_ASSERT ( ! vdesktop->data.empty() );
   CPPUNIT_ASSERT ( test::getAreaSize(vdesktop) == 1920 );
@@ -1105,8 +1166,8 @@ void FVTermTest::FVTermBasesTest()
   CPPUNIT_ASSERT ( ! vterm->minimized );
   CPPUNIT_ASSERT ( vterm->preproc_list.empty() );
   CPPUNIT_ASSERT ( ! vterm->changes.empty() );
-  CPPUNIT_ASSERT ( vterm->changes[0].xmin == 80 );
-  CPPUNIT_ASSERT ( vterm->changes[0].xmax == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getXmin() == 80 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getXmax() == 0 );
   CPPUNIT_ASSERT ( vterm->changes[0].trans_count == 0 );
   CPPUNIT_ASSERT ( ! vterm->data.empty() );
   CPPUNIT_ASSERT ( test::getAreaSize(vterm) == 1920 );
@@ -1124,8 +1185,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{0}; i < vwin->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vwin->changes[i].xmin == 22 );
-    CPPUNIT_ASSERT ( vwin->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXmin() == 22 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vwin->changes[i].trans_count == 0 );
   }
 
@@ -1135,8 +1196,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{0}; i < vwin->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vwin->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vwin->changes[i].xmax == 21 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXmin() == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXmax() == 21 );
     CPPUNIT_ASSERT ( vwin->changes[i].trans_count == 2 );
   }
 
@@ -1144,8 +1205,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{vwin->size.height}; i < full_height; i++)
   {
-    CPPUNIT_ASSERT ( vwin->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vwin->changes[i].xmax == 21 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXmin() == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[i].getXmax() == 21 );
     CPPUNIT_ASSERT ( vwin->changes[i].trans_count == 22 );
   }
 
@@ -1153,7 +1214,6 @@ void FVTermTest::FVTermBasesTest()
   finalcut::FChar bg_char =
   {
     { L'▒', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -1174,7 +1234,6 @@ void FVTermTest::FVTermBasesTest()
   auto width = std::size_t(vwin->size.width);
   finalcut::FChar shadow_char =
   {
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
@@ -1380,14 +1439,13 @@ void FVTermTest::FVTermBasesTest()
   // Reset line changes
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    vterm->changes[i].xmin = uInt(vterm->size.width - 1);
-    vterm->changes[i].xmax = 0;
+    vterm->changes[i].reset (uInt(vterm->size.width - 1));
   }
 
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 69 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 69 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
   }
 
   // Force all lines of the virtual terminal to be output
@@ -1395,8 +1453,8 @@ void FVTermTest::FVTermBasesTest()
 
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 69 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 69 );
   }
 
   // Change the width only
@@ -1497,7 +1555,6 @@ void FVTermTest::FVTermPrintTest()
     finalcut::FChar default_char =
     {
       { L' ', L'\0', L'\0', L'\0', L'\0' },
-      { L'\0', L'\0', L'\0', L'\0', L'\0' },
       finalcut::FColor::Default,
       finalcut::FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -1674,7 +1731,6 @@ void FVTermTest::FVTermPrintTest()
     // std::vector<FChar>
     finalcut::FChar fchar =
     {
-      { L'\0', L'\0', L'\0', L'\0', L'\0' },
       { L'\0', L'\0', L'\0', L'\0', L'\0' },
       finalcut::FColor::Red,
       finalcut::FColor::White,
@@ -1723,8 +1779,8 @@ void FVTermTest::FVTermPrintTest()
     p_fvterm.print(vwin, term_string);
     CPPUNIT_ASSERT ( p_fvterm.print(nullptr, L'⌚') == -1 );
     p_fvterm.print(fchar);
-    CPPUNIT_ASSERT ( vwin->changes[4].xmin == 0 );
-    CPPUNIT_ASSERT ( vwin->changes[4].xmax == 1 );  // padding char or '.'
+    CPPUNIT_ASSERT ( vwin->changes[4].getXmin() == 0 );
+    CPPUNIT_ASSERT ( vwin->changes[4].getXmax() == 1 );  // padding char or '.'
 
     if ( enc == finalcut::Encoding::VT100 )
     {
@@ -2031,8 +2087,8 @@ void FVTermTest::FVTermChildAreaPrintTest()
 
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
@@ -2057,29 +2113,28 @@ void FVTermTest::FVTermChildAreaPrintTest()
 
   for (auto i{0}; i < 3; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   for (auto i{3}; i < 11; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 35 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 44 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 35 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 44 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   for (auto i{11}; i < 24; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   finalcut::FChar space_char_1 =
   {
     { L' ', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2088,7 +2143,6 @@ void FVTermTest::FVTermChildAreaPrintTest()
   finalcut::FChar space_char_2 =
   {
     { L' ', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Red,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2097,7 +2151,6 @@ void FVTermTest::FVTermChildAreaPrintTest()
   finalcut::FChar equal_sign_char =
   {
     { L'=', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Red,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2152,7 +2205,6 @@ void FVTermTest::FVTermScrollTest()
   finalcut::FChar one_char =
   {
     { L'1', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2366,6 +2418,65 @@ void FVTermTest::FVTermScrollTest()
   test::printArea (vdesktop);
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermScrollRegionTest()
+{
+  // aaaaaaaaaa
+  // aaaaaaaaaa
+  // aaaaaaaaaabbbb
+  // aaaaaaaaaabbbb
+  //           bbbb
+
+  FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+  auto& scroll_regions = FTermOutputTest::getScrollRegions();
+  finalcut::FRect geometry_1 {finalcut::FPoint{0, 0}, finalcut::FSize{10, 4}};
+  finalcut::FRect geometry_2 {finalcut::FPoint{10, 2}, finalcut::FSize{4, 3}};
+  auto vwin_1_ptr = p_fvterm_1.p_createArea (geometry_1);
+  auto vwin_2_ptr = p_fvterm_2.p_createArea (geometry_2);
+  auto vwin_1 = vwin_1_ptr.get();
+  auto vwin_2 = vwin_2_ptr.get();
+  p_fvterm_1.setVWin(std::move(vwin_1_ptr));
+  p_fvterm_2.setVWin(std::move(vwin_2_ptr));
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_1);
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_2);
+  vwin_1->visible = true;
+  vwin_2->visible = true;
+  p_fvterm_1.p_determineWindowLayers();
+
+  // A window without an overlapping window is scrolled on the terminal
+  scroll_regions.clear();
+  p_fvterm_1.p_scrollAreaForward (vwin_1);
+  p_fvterm_1.p_scrollAreaReverse (vwin_1);
+  CPPUNIT_ASSERT ( scroll_regions.size() == 2 );
+  CPPUNIT_ASSERT ( scroll_regions[0] == finalcut::FRect(0, 0, 10, 4) );
+  CPPUNIT_ASSERT ( scroll_regions[1] == finalcut::FRect(0, 0, 10, 4) );
+
+  // A higher window over the scrolled lines forces a redraw
+  vwin_2->position.x = 8;
+  scroll_regions.clear();
+  p_fvterm_1.p_scrollAreaForward (vwin_1);
+  p_fvterm_1.p_scrollAreaReverse (vwin_1);
+  CPPUNIT_ASSERT ( scroll_regions.empty() );
+  CPPUNIT_ASSERT ( vwin_1->changes[0].getXmin() == 0 );
+  CPPUNIT_ASSERT ( vwin_1->changes[0].getXmax() == 9 );
+
+  // The window on top is scrolled on the terminal
+  p_fvterm_1.p_scrollAreaForward (vwin_2);
+  CPPUNIT_ASSERT ( scroll_regions.size() == 1 );
+  CPPUNIT_ASSERT ( scroll_regions[0] == finalcut::FRect(8, 2, 4, 3) );
+
+  // A lower window does not prevent the scrolling
+  std::swap ( (*finalcut::FVTerm::getWindowList())[0]
+            , (*finalcut::FVTerm::getWindowList())[1] );
+  p_fvterm_1.p_determineWindowLayers();
+  scroll_regions.clear();
+  p_fvterm_1.p_scrollAreaForward (vwin_1);
+  CPPUNIT_ASSERT ( scroll_regions.size() == 1 );
+  CPPUNIT_ASSERT ( scroll_regions[0] == finalcut::FRect(0, 0, 10, 4) );
+  scroll_regions.clear();
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::FVTermOverlappingWindowsTest()
 {
@@ -2480,7 +2591,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar bg_char =
   {
     { L'.', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::DarkGray,
     finalcut::FColor::LightBlue,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2494,7 +2604,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_1_char =  // with color overlay
   {
     { L'.', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Black,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2503,7 +2612,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_2_char =  // with inherit background
   {
     { L'▒', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Black,
     finalcut::FColor::LightBlue,
     { { 0x00, 0x80, 0x08, 0x00} }  // byte 0..3
@@ -2512,7 +2620,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_3_char =  // with transparency
   {
     { L'.', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::DarkGray,
     finalcut::FColor::LightBlue,
     { { 0x00, 0x00, 0x09, 0x00} }  // byte 0..3
@@ -2521,7 +2628,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_4_char =
   {
     { L'█', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Black,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2694,6 +2800,456 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   CPPUNIT_ASSERT ( test::isAreaEqual(test_area, vterm) );
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermOcclusionTest()
+{
+  // aaaaaaaaaa
+  // aaaaabbbb#bb
+  // aaaaabbbb#bb
+  //      bbbb#bb
+  //
+  // # : transparency
+
+  FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm_1.p_getVirtualTerminal();
+  auto&& vdesktop = p_fvterm_1.p_getVirtualDesktop();
+
+  finalcut::FRect geometry_1 {finalcut::FPoint{0, 0}, finalcut::FSize{10, 3}};
+  finalcut::FRect geometry_2 {finalcut::FPoint{5, 1}, finalcut::FSize{7, 3}};
+  auto vwin_1_ptr = p_fvterm_1.p_createArea (geometry_1);
+  auto vwin_2_ptr = p_fvterm_2.p_createArea (geometry_2);
+  auto vwin_1 = vwin_1_ptr.get();
+  auto vwin_2 = vwin_2_ptr.get();
+  p_fvterm_1.setVWin(std::move(vwin_1_ptr));
+  p_fvterm_2.setVWin(std::move(vwin_2_ptr));
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_1);
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_2);
+
+  for (auto y{1}; y <= 3; y++)
+  {
+    p_fvterm_1.print() << finalcut::FPoint{1, y} << "aaaaaaaaaa";
+    p_fvterm_2.print() << finalcut::FPoint{6, y + 1} << "bbbb"
+                       << finalcut::FStyle {finalcut::Style::Transparent}
+                       << "#"
+                       << finalcut::FStyle {finalcut::Style::None}
+                       << "bb";
+  }
+
+  vwin_1->visible = true;
+  vwin_2->visible = true;
+  p_fvterm_1.p_determineWindowLayers();
+  p_fvterm_1.p_clearArea (vdesktop, L'.');
+  p_fvterm_1.p_processTerminalUpdate();
+
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(4, 1).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(5, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 1).ch[0] == L'a' );  // Transparent
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 3).ch[0] == L'.' );  // Transparent
+  CPPUNIT_ASSERT ( vterm->getFChar(12, 0).ch[0] == L'.' );
+  CPPUNIT_ASSERT ( ! vwin_1->has_changes );
+  CPPUNIT_ASSERT ( ! vwin_2->has_changes );
+
+  // Changes hidden under an opaque window character
+  // do not reach the virtual terminal
+  p_fvterm_1.print() << finalcut::FPoint{6, 2} << "xxx";
+  CPPUNIT_ASSERT ( vwin_1->has_changes );
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(5, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(7, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( ! vwin_2->has_changes );
+  CPPUNIT_ASSERT ( vwin_2->changes[0].getXmin() > vwin_2->changes[0].getXmax() );
+
+  // Changes under a transparent character are visible
+  p_fvterm_1.print() << finalcut::FPoint{9, 2} << "yy";
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(8, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 1).ch[0] == L'y' );
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( ! vwin_2->has_changes );
+
+  // Desktop changes do not overwrite the windows
+  for (auto y{1}; y <= 4; y++)
+  {
+    vdesktop->setCursorPos (1, y);
+    p_fvterm_1.print (vdesktop, finalcut::FString(14, L':'));
+  }
+
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(5, 1).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 1).ch[0] == L'y' );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 3).ch[0] == L':' );  // Transparent
+  CPPUNIT_ASSERT ( vterm->getFChar(12, 0).ch[0] == L':' );
+  CPPUNIT_ASSERT ( vterm->getFChar(2, 3).ch[0] == L':' );
+
+  // A moved window uncovers the characters below
+  const finalcut::FRect old_geometry {finalcut::FPoint{6, 2}, finalcut::FSize{7, 3}};
+  const finalcut::FRect new_geometry {finalcut::FPoint{21, 11}, finalcut::FSize{7, 3}};
+  test::moveArea (vwin_2, finalcut::FPoint{20, 10});
+  p_fvterm_1.p_restoreVTerm(old_geometry);
+  p_fvterm_1.p_restoreVTerm(new_geometry);
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(5, 1).ch[0] == L'x' );
+  CPPUNIT_ASSERT ( vterm->getFChar(7, 1).ch[0] == L'x' );
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 1).ch[0] == L':' );
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 10).ch[0] == L'b' );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermLineSpansTest()
+{
+  using FLineChanges = finalcut::FVTerm::FLineChanges;
+  FLineChanges line_changes{};
+  line_changes.reset (80);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 0 );
+
+  // Separate changes
+  line_changes.mark (2, 5);
+  line_changes.mark (70, 75);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXmin() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getXmax() == 75 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 5 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 70 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 75 );
+
+  // Adjacent and overlapping changes are joined
+  line_changes.mark (6, 8);
+  line_changes.mark (68, 71);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 8 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 68 );
+
+  // Without a free slot the spans with the smallest gap are joined
+  line_changes.mark (20, 21);
+  line_changes.mark (40, 41);
+  line_changes.mark (30, 31);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == FLineChanges::MAX_SPANS );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 8 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmin == 20 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(1).xmax == 31 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(2).xmin == 40 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(3).xmax == 75 );
+
+  // A span covering the gaps
+  line_changes.mark (5, 50);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 50 );
+
+  // set() replaces all spans
+  line_changes.set (0, 75);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 1 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmin == 0 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 75 );
+  line_changes.mark (78, 79);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( line_changes.getSpan(0).xmax == 75 );
+  CPPUNIT_ASSERT ( line_changes.getXmax() == 79 );
+
+  line_changes.reset (80);
+  CPPUNIT_ASSERT ( line_changes.getSpanCount() == 0 );
+  CPPUNIT_ASSERT ( line_changes.getXmin() == 80 );
+  CPPUNIT_ASSERT ( line_changes.getXmax() == 0 );
+
+  // A clock on the left and a counter on the right
+  // only update their own columns
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm.p_getVirtualTerminal();
+  finalcut::FRect geometry {finalcut::FPoint{0, 0}, finalcut::FSize{40, 2}};
+  auto vwin_ptr = p_fvterm.p_createArea (geometry);
+  auto vwin = vwin_ptr.get();
+  p_fvterm.setVWin(std::move(vwin_ptr));
+  vwin->visible = true;
+  p_fvterm.print() << finalcut::FPoint{1, 1} << finalcut::FString(40, L'-');
+  p_fvterm.p_addLayer(vwin);
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 0).ch[0] == L'-' );
+
+  vterm->getFChar(20, 0).ch[0] = L'?';
+  vterm->changes[0].reset (uInt(vterm->size.width));
+  p_fvterm.print() << finalcut::FPoint{1, 1} << "12:00";
+  p_fvterm.print() << finalcut::FPoint{36, 1} << "00042";
+  CPPUNIT_ASSERT ( vwin->changes[0].getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( vwin->changes[0].getXmin() == 0 );
+  CPPUNIT_ASSERT ( vwin->changes[0].getXmax() == 39 );
+  p_fvterm.p_addLayer(vwin);
+  CPPUNIT_ASSERT ( vwin->changes[0].getSpanCount() == 0 );
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'1' );
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 0).ch[0] == L'?' );  // Untouched
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 0).ch[0] == L'2' );
+  CPPUNIT_ASSERT ( vterm->changes[0].getSpanCount() == 2 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getSpan(0).xmax == 4 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getSpan(1).xmin == 35 );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermTransparentStackTest()
+{
+  // aaaaaaXToi#Z.
+  //
+  // T : transparency
+  // o : color overlay
+  // i : inherit background
+
+  FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm_1.p_getVirtualTerminal();
+  auto&& vdesktop = p_fvterm_1.p_getVirtualDesktop();
+
+  finalcut::FRect geometry_1 {finalcut::FPoint{0, 0}, finalcut::FSize{10, 1}};
+  finalcut::FRect geometry_2 {finalcut::FPoint{6, 0}, finalcut::FSize{6, 1}};
+  auto vwin_1_ptr = p_fvterm_1.p_createArea (geometry_1);
+  auto vwin_2_ptr = p_fvterm_2.p_createArea (geometry_2);
+  auto vwin_1 = vwin_1_ptr.get();
+  auto vwin_2 = vwin_2_ptr.get();
+  p_fvterm_1.setVWin(std::move(vwin_1_ptr));
+  p_fvterm_2.setVWin(std::move(vwin_2_ptr));
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_1);
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_2);
+
+  p_fvterm_1.print() << finalcut::FPoint{1, 1}
+                     << finalcut::FColorPair {finalcut::FColor::Blue, finalcut::FColor::Red}
+                     << "aaaaaaaaaa";
+  p_fvterm_2.print() << finalcut::FPoint{7, 1}
+                     << finalcut::FColorPair {finalcut::FColor::Black, finalcut::FColor::White}
+                     << "X"
+                     << finalcut::FStyle {finalcut::Style::Transparent}
+                     << "T"
+                     << finalcut::FStyle {finalcut::Style::None}
+                     << finalcut::FColorPair {finalcut::FColor::Green, finalcut::FColor::Yellow}
+                     << finalcut::FStyle {finalcut::Style::ColorOverlay}
+                     << "o"
+                     << finalcut::FStyle {finalcut::Style::None}
+                     << finalcut::FColorPair {finalcut::FColor::Cyan, finalcut::FColor::Yellow}
+                     << finalcut::FStyle {finalcut::Style::InheritBackground}
+                     << "i"
+                     << finalcut::FStyle {finalcut::Style::None}
+                     << finalcut::FStyle {finalcut::Style::Transparent}
+                     << "T"
+                     << finalcut::FStyle {finalcut::Style::None}
+                     << finalcut::FColorPair {finalcut::FColor::Black, finalcut::FColor::White}
+                     << "Z";
+
+  vwin_1->visible = true;
+  vwin_2->visible = true;
+  p_fvterm_1.p_determineWindowLayers();
+  p_fvterm_1.p_clearArea (vdesktop, L'.');
+  p_fvterm_1.p_processTerminalUpdate();
+
+  // Copying the upper window resolves its transparent characters
+  // from the layers below
+  for (auto x{6}; x < 12; x++)
+    vterm->getFChar(x, 0).ch[0] = L'?';
+
+  p_fvterm_2.p_putArea (finalcut::FPoint{7, 1}, vwin_2);
+  CPPUNIT_ASSERT ( vterm->getFChar(5, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(6, 0).ch[0] == L'X' );
+  CPPUNIT_ASSERT ( vterm->getFChar(7, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(7, 0).fg_color == finalcut::FColor::Blue );
+  CPPUNIT_ASSERT ( vterm->getFChar(8, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(8, 0).fg_color == finalcut::FColor::Green );
+  CPPUNIT_ASSERT ( vterm->getFChar(8, 0).bg_color == finalcut::FColor::Yellow );
+  CPPUNIT_ASSERT ( ! vterm->getFChar(8, 0).attr.bit.color_overlay );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 0).ch[0] == L'i' );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 0).fg_color == finalcut::FColor::Cyan );
+  CPPUNIT_ASSERT ( vterm->getFChar(9, 0).bg_color == finalcut::FColor::Red );
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 0).ch[0] == L'.' );  // Desktop
+  CPPUNIT_ASSERT ( vterm->getFChar(11, 0).ch[0] == L'Z' );
+  CPPUNIT_ASSERT ( vterm->changes[0].getXmin() <= 6 );
+  CPPUNIT_ASSERT ( vterm->changes[0].getXmax() >= 11 );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermDirtyWindowTest()
+{
+  FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm_1.p_getVirtualTerminal();
+  auto&& vdesktop = p_fvterm_1.p_getVirtualDesktop();
+
+  finalcut::FRect geometry_1 {finalcut::FPoint{0, 0}, finalcut::FSize{8, 2}};
+  finalcut::FRect geometry_2 {finalcut::FPoint{10, 0}, finalcut::FSize{8, 2}};
+  auto vwin_1_ptr = p_fvterm_1.p_createArea (geometry_1);
+  auto vwin_2_ptr = p_fvterm_2.p_createArea (geometry_2);
+  auto vwin_1 = vwin_1_ptr.get();
+  auto vwin_2 = vwin_2_ptr.get();
+  p_fvterm_1.setVWin(std::move(vwin_1_ptr));
+  p_fvterm_2.setVWin(std::move(vwin_2_ptr));
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_1);
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_2);
+
+  // A changed area is queued in the dirty area list
+  CPPUNIT_ASSERT ( ! vwin_1->dirty_queued );
+  p_fvterm_1.print() << finalcut::FPoint{1, 1} << "aaaaaaaa";
+  CPPUNIT_ASSERT ( vwin_1->has_changes );
+  CPPUNIT_ASSERT ( vwin_1->dirty_queued );
+
+  vwin_1->visible = true;
+  p_fvterm_1.p_determineWindowLayers();
+  p_fvterm_1.p_clearArea (vdesktop, L'.');
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( ! vwin_1->has_changes );
+  CPPUNIT_ASSERT ( ! vwin_1->dirty_queued );
+
+  // Changes of a hidden window stay queued
+  p_fvterm_2.print() << finalcut::FPoint{11, 1} << "bbbbbbbb";
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 0).ch[0] == L'.' );
+  CPPUNIT_ASSERT ( vwin_2->has_changes );
+  CPPUNIT_ASSERT ( vwin_2->dirty_queued );
+
+  vwin_2->visible = true;
+  p_fvterm_1.p_determineWindowLayers();
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 0).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( ! vwin_2->has_changes );
+  CPPUNIT_ASSERT ( ! vwin_2->dirty_queued );
+
+  // Unchanged windows are not touched
+  vterm->getFChar(1, 1).ch[0] = L'?';
+  p_fvterm_2.print() << finalcut::FPoint{11, 2} << "cc";
+  p_fvterm_1.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(10, 1).ch[0] == L'c' );
+  CPPUNIT_ASSERT ( vterm->getFChar(1, 1).ch[0] == L'?' );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermBandCompositingTest()
+{
+  // Composites two overlapping windows and returns the virtual terminal
+  // characters and the number of changed terminal lines
+  auto composite = [] ()
+  {
+    FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+    FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+    auto&& vterm = p_fvterm_1.p_getVirtualTerminal();
+    auto&& vdesktop = p_fvterm_1.p_getVirtualDesktop();
+
+    finalcut::FRect geometry_1 {finalcut::FPoint{0, 0}, finalcut::FSize{40, 24}};
+    finalcut::FRect geometry_2 {finalcut::FPoint{20, 2}, finalcut::FSize{30, 20}};
+    auto vwin_1_ptr = p_fvterm_1.p_createArea (geometry_1);
+    auto vwin_2_ptr = p_fvterm_2.p_createArea (geometry_2);
+    auto vwin_1 = vwin_1_ptr.get();
+    auto vwin_2 = vwin_2_ptr.get();
+    p_fvterm_1.setVWin(std::move(vwin_1_ptr));
+    p_fvterm_2.setVWin(std::move(vwin_2_ptr));
+    finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_1);
+    finalcut::FVTerm::getWindowList()->push_back(&p_fvterm_2);
+
+    for (auto y{1}; y <= 24; y++)
+    {
+      p_fvterm_1.print() << finalcut::FPoint{1, y}
+                         << finalcut::FColorPair {finalcut::FColor::Blue, finalcut::FColor::Red}
+                         << finalcut::FString{40, wchar_t(L'a' + y % 26)};
+    }
+
+    for (auto y{3}; y <= 22; y++)
+    {
+      p_fvterm_2.print() << finalcut::FPoint{21, y};
+
+      for (auto x{0}; x < 30; x++)
+      {
+        if ( (x + y) % 3 == 0 )
+          p_fvterm_2.print() << finalcut::FStyle {finalcut::Style::Transparent};
+        else if ( (x + y) % 3 == 1 )
+          p_fvterm_2.print() << finalcut::FColorPair {finalcut::FColor::Green, finalcut::FColor::Yellow}
+                             << finalcut::FStyle {finalcut::Style::ColorOverlay};
+
+        p_fvterm_2.print() << "X" << finalcut::FStyle {finalcut::Style::None};
+      }
+    }
+
+    vwin_1->visible = true;
+    vwin_2->visible = true;
+    p_fvterm_1.p_determineWindowLayers();
+    p_fvterm_1.p_clearArea (vdesktop, L'.');
+    p_fvterm_1.p_processTerminalUpdate();
+
+    // Changes below the transparent window are passed to it
+    for (auto y{1}; y <= 24; y += 2)
+      p_fvterm_1.print() << finalcut::FPoint{15, y} << finalcut::FString{20, L'Z'};
+
+    p_fvterm_1.p_processTerminalUpdate();
+    CPPUNIT_ASSERT ( ! vwin_2->has_changes );
+
+    std::vector<finalcut::FChar> chars(vterm->data);
+    return chars;
+  };
+
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 1 );
+  const auto serial = composite();
+  CPPUNIT_ASSERT ( serial[0].ch[0] == L'b' );
+  CPPUNIT_ASSERT ( serial[14].ch[0] == L'Z' );
+  CPPUNIT_ASSERT ( serial[3 * 80 + 21].ch[0] == L'X' );
+
+  finalcut::FVTerm::setCompositingThreads(4);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 4 );
+  const auto parallel = composite();
+  finalcut::FVTerm::setCompositingThreads(0);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getCompositingThreads() == 1 );
+
+  // The band-parallel compositing gives the same result
+  CPPUNIT_ASSERT ( serial.size() == parallel.size() );
+  CPPUNIT_ASSERT ( serial == parallel );
+}
+
+//----------------------------------------------------------------------
+void FVTermTest::FVTermFramePacingTest()
+{
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm.p_getVirtualTerminal();
+  auto&& vdesktop = p_fvterm.p_getVirtualDesktop();
+
+  finalcut::FRect geometry {finalcut::FPoint{0, 0}, finalcut::FSize{10, 2}};
+  auto vwin_ptr = p_fvterm.p_createArea (geometry);
+  auto vwin = vwin_ptr.get();
+  p_fvterm.setVWin(std::move(vwin_ptr));
+  finalcut::FVTerm::getWindowList()->push_back(&p_fvterm);
+  vwin->visible = true;
+  p_fvterm.p_determineWindowLayers();
+  p_fvterm.p_clearArea (vdesktop, L'.');
+  p_fvterm.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( ! finalcut::FVTerm::hasPendingTerminalUpdates() );
+
+  // Frame rate limit
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getTargetFrameRate() == 0 );
+  finalcut::FVTerm::setTargetFrameRate(10);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getTargetFrameRate() == 10 );
+  finalcut::FVTerm::setTargetFrameRate(0);
+  CPPUNIT_ASSERT ( finalcut::FVTerm::getTargetFrameRate() == 0 );
+
+  // Drawing between two frames is coalesced
+  FTermOutputTest::setFrameDue(false);
+  p_fvterm.print() << finalcut::FPoint{1, 1} << "abc";
+  CPPUNIT_ASSERT ( ! p_fvterm.p_processTerminalUpdate() );
+  p_fvterm.print() << finalcut::FPoint{1, 2} << "xyz";
+  CPPUNIT_ASSERT ( ! p_fvterm.p_processTerminalUpdate() );
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] != L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 1).ch[0] != L'x' );
+  CPPUNIT_ASSERT ( vwin->has_changes );
+  CPPUNIT_ASSERT ( finalcut::FVTerm::hasPendingTerminalUpdates() );
+
+  // The next frame composites all changes at once
+  FTermOutputTest::setFrameDue(true);
+  p_fvterm.p_processTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 1).ch[0] == L'x' );
+  CPPUNIT_ASSERT ( ! vwin->has_changes );
+
+  // A forced update does not wait for the next frame
+  FTermOutputTest::setFrameDue(false);
+  p_fvterm.print() << finalcut::FPoint{1, 1} << "def";
+  p_fvterm.p_forceTerminalUpdate();
+  CPPUNIT_ASSERT ( vterm->getFChar(0, 0).ch[0] == L'd' );
+  FTermOutputTest::setFrameDue(true);
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::FVTermReduceUpdatesTest()
 {
@@ -2738,15 +3294,15 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 15; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 0 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 14 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 14 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   for (auto i{15}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
@@ -2758,11 +3314,10 @@ void FVTermTest::FVTermReduceUpdatesTest()
   // Simulate printing
   for (auto y{0}; y < vterm->size.height; y++)
   {
-    for (auto x{vterm->changes[y].xmin}; x < vterm->changes[y].xmax; x++)
+    for (auto x{vterm->changes[y].getXmin()}; x < vterm->changes[y].getXmax(); x++)
       vterm->getFChar(int(x), int(y)).attr.bit.printed = true;
 
-    vterm->changes[y].xmin = uInt(vterm->size.width);
-    vterm->changes[y].xmax = 0;
+    vterm->changes[y].reset (uInt(vterm->size.width));
   }
 
   for (auto y{0}; y < vterm->size.height; y++)
@@ -2802,47 +3357,46 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 6; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
-  CPPUNIT_ASSERT ( vterm->changes[6].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[6].xmax == 11 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXmin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXmax() == 11 );
   CPPUNIT_ASSERT ( vterm->changes[6].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[7].xmin == 12 );
-  CPPUNIT_ASSERT ( vterm->changes[7].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXmin() == 12 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXmax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[7].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[8].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[8].xmax == 1 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXmin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXmax() == 1 );
   CPPUNIT_ASSERT ( vterm->changes[8].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[9].xmin == 13 );
-  CPPUNIT_ASSERT ( vterm->changes[9].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXmin() == 13 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXmax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[9].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[10].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[10].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXmin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXmax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[10].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[11].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[11].xmax == 9 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXmin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXmax() == 9 );
   CPPUNIT_ASSERT ( vterm->changes[11].trans_count == 0 );
 
   for (auto i{12}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
   // Reset xmin and xmax values + reduceTerminalLineUpdates()
   for (auto i{0}; i < vterm->size.height; i++)
   {
-    vterm->changes[i].xmin = 0;
-    vterm->changes[i].xmax = 14;
+    vterm->changes[i].set (0, 14);
     finalcut::FVTerm::reduceTerminalLineUpdates(i);
   }
 
@@ -2869,39 +3423,39 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 6; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 14 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 13 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 14 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 13 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
-  CPPUNIT_ASSERT ( vterm->changes[6].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[6].xmax == 11 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXmin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[6].getXmax() == 11 );
   CPPUNIT_ASSERT ( vterm->changes[6].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[7].xmin == 12 );
-  CPPUNIT_ASSERT ( vterm->changes[7].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXmin() == 12 );
+  CPPUNIT_ASSERT ( vterm->changes[7].getXmax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[7].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[8].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[8].xmax == 1 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXmin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[8].getXmax() == 1 );
   CPPUNIT_ASSERT ( vterm->changes[8].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[9].xmin == 13 );
-  CPPUNIT_ASSERT ( vterm->changes[9].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXmin() == 13 );
+  CPPUNIT_ASSERT ( vterm->changes[9].getXmax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[9].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[10].xmin == 0 );
-  CPPUNIT_ASSERT ( vterm->changes[10].xmax == 14 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXmin() == 0 );
+  CPPUNIT_ASSERT ( vterm->changes[10].getXmax() == 14 );
   CPPUNIT_ASSERT ( vterm->changes[10].trans_count == 0 );
 
-  CPPUNIT_ASSERT ( vterm->changes[11].xmin == 5 );
-  CPPUNIT_ASSERT ( vterm->changes[11].xmax == 9 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXmin() == 5 );
+  CPPUNIT_ASSERT ( vterm->changes[11].getXmax() == 9 );
   CPPUNIT_ASSERT ( vterm->changes[11].trans_count == 0 );
 
   for (auto i{12}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 14 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 13 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmin() == 14 );
+    CPPUNIT_ASSERT ( vterm->changes[i].getXmax() == 13 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 }
@@ -2973,7 +3527,6 @@ void FVTermTest::getFVTermAreaTest()
   finalcut::FChar bg_char =
   {
     { L' ', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -81,12 +81,6 @@ void showFCharData (const finalcut::FChar& fchar)
                           uInt32(fchar.ch[2]) << L", " <<
                           uInt32(fchar.ch[3]) << L", " <<
                           uInt32(fchar.ch[4]) << L"}\n";
-  std::wcout << L"               encoded_char: '" <<  fchar.encoded_char.data();
-  std::wcout << L"' {" << uInt32(fchar.encoded_char[0]) << L", " <<
-                          uInt32(fchar.encoded_char[1]) << L", " <<
-                          uInt32(fchar.encoded_char[2]) << L", " <<
-                          uInt32(fchar.encoded_char[3]) << L", " <<
-                          uInt32(fchar.encoded_char[4]) << L"}\n";
   std::wcout << L"                   fg_color: " << int(fchar.fg_color) << L'\n';
   std::wcout << L"                   bg_color: " << int(fchar.bg_color) << L'\n';
   std::wcout << L"                    attr[0]: " << int(fchar.attr.byte[0]) << L'\n';
@@ -167,7 +161,6 @@ auto isFCharEqual ( const finalcut::FChar& lhs
   attr.bit.printed = true;
 
   return finalcut::isFUnicodeEqual(lhs.ch, rhs.ch)
-      && finalcut::isFUnicodeEqual(lhs.encoded_char, rhs.encoded_char)
       && lhs.fg_color     == rhs.fg_color
       && lhs.bg_color     == rhs.bg_color
       && lhs.attr.byte[0] == rhs.attr.byte[0]
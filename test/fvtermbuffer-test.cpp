@@ -59,6 +59,7 @@ class FVTermBufferTest : public CPPUNIT_NS::TestFixture
     void streamTest();
     void indexTest();
     void combiningCharacterTest();
+    void glyphRunCacheTest();
 
   private:
     // Adds code needed to register the test suite
@@ -71,6 +72,7 @@ class FVTermBufferTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (streamTest);
     CPPUNIT_TEST (indexTest);
     CPPUNIT_TEST (combiningCharacterTest);
+    CPPUNIT_TEST (glyphRunCacheTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -120,11 +122,6 @@ void FVTermBufferTest::writeTest()
   CPPUNIT_ASSERT ( vterm_buf.front().ch[2] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().ch[3] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().ch[4] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[0] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[1] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[2] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[3] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[4] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( vterm_buf.front().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( vterm_buf.front().attr.byte[0] == 0 );
@@ -156,11 +153,6 @@ void FVTermBufferTest::writeTest()
   CPPUNIT_ASSERT ( vterm_buf.front().ch[2] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().ch[3] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().ch[4] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[0] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[1] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[2] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[3] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[4] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( vterm_buf.front().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( vterm_buf.front().attr.byte[0] == 0 );
@@ -204,11 +196,6 @@ void FVTermBufferTest::writeTest()
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[2] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[3] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[4] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[0] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[1] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[2] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[3] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[4] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].fg_color == finalcut::FColor::Default );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].bg_color == finalcut::FColor::Default );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[0] == 0 );
@@ -238,11 +225,6 @@ void FVTermBufferTest::writeTest()
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[2] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[3] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[4] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[0] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[1] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[2] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[3] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[4] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].fg_color == finalcut::FColor::Default );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].bg_color == finalcut::FColor::Default );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[0] == 0 );
@@ -288,11 +270,6 @@ void FVTermBufferTest::writeTest()
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[2] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[3] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[4] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[0] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[1] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[2] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[3] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[4] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[0] == 0 );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[1] == 0 );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[2] != 0 );
@@ -349,11 +326,6 @@ void FVTermBufferTest::writeTest()
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[2] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[3] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[4] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[0] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[1] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[2] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[3] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[4] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[3] == 0 );
 
     if ( multi_color_emojis )
@@ -376,11 +348,6 @@ void FVTermBufferTest::writeTest()
   CPPUNIT_ASSERT ( vterm_buf.front().ch[2] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().ch[3] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().ch[4] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[0] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[1] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[2] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[3] == L'\0' );
-  CPPUNIT_ASSERT ( vterm_buf.front().encoded_char[4] == L'\0' );
   CPPUNIT_ASSERT ( vterm_buf.front().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( vterm_buf.front().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( vterm_buf.front().attr.byte[0] == 0 );
@@ -487,11 +454,6 @@ void FVTermBufferTest::streamTest()
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[2] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[3] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].ch[4] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[0] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[1] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[2] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[3] == L'\0' );
-    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].encoded_char[4] == L'\0' );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[2] != 0 );
     CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i].attr.byte[3] == 0 );
   }
@@ -1038,6 +1000,97 @@ void FVTermBufferTest::combiningCharacterTest()
   CPPUNIT_ASSERT ( vterm_buf.toString() == L"पन्ह पन्ह त्र र्च कृकृ ड्ड न्ह" );
 }
 
+//----------------------------------------------------------------------
+void FVTermBufferTest::glyphRunCacheTest()
+{
+  auto& fterm_data = finalcut::FTermData::getInstance();
+  fterm_data.setTermEncoding (finalcut::Encoding::UTF8);
+  finalcut::FVTerm::setNormal();
+  const finalcut::FString label{L"\U0000ff21 Ok\U00000300"};  // Ａ Ok̀
+  finalcut::FVTermBuffer vterm_buf{};
+
+  // The same string printed twice (second time from the cache)
+  vterm_buf.print(label);
+  vterm_buf.print(label);
+  CPPUNIT_ASSERT ( vterm_buf.getLength() == 8 );
+  CPPUNIT_ASSERT ( vterm_buf.toString() == label + label );
+
+  for (std::size_t i{0}; i < 4; i++)
+    CPPUNIT_ASSERT ( vterm_buf.getBuffer()[i] == vterm_buf.getBuffer()[i + 4] );
+
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[4].ch[0] == L'\U0000ff21' );
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[4].attr.bit.char_width == 2 );
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[7].ch[0] == L'k' );
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[7].ch[1] == L'\U00000300' );
+
+  // A changed color must not use the cached run
+  vterm_buf.clear();
+  vterm_buf.print (finalcut::FColorPair(finalcut::FColor::Blue, finalcut::FColor::White));
+  vterm_buf.print(label);
+  CPPUNIT_ASSERT ( vterm_buf.getLength() == 4 );
+
+  for (const auto& fchar : vterm_buf)
+  {
+    CPPUNIT_ASSERT ( fchar.fg_color == finalcut::FColor::Blue );
+    CPPUNIT_ASSERT ( fchar.bg_color == finalcut::FColor::White );
+  }
+
+  // A changed style must not use the cached run
+  vterm_buf.clear();
+  vterm_buf.print (finalcut::FStyle(finalcut::Style::Bold));
+  vterm_buf.print(label);
+  CPPUNIT_ASSERT ( vterm_buf.getLength() == 4 );
+
+  for (const auto& fchar : vterm_buf)
+    CPPUNIT_ASSERT ( fchar.attr.bit.bold == 1 );
+
+  // A changed terminal encoding must not use the cached run
+  finalcut::FVTerm::setNormal();
+  fterm_data.setTermEncoding (finalcut::Encoding::VT100);
+  vterm_buf.clear();
+  vterm_buf.print(label);
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[0].ch[0] == L'\U0000ff21' );
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[0].attr.bit.char_width == 1 );
+
+  fterm_data.setTermEncoding (finalcut::Encoding::UTF8);
+  vterm_buf.clear();
+  vterm_buf.print(label);
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[0].ch[0] == L'\U0000ff21' );
+  CPPUNIT_ASSERT ( vterm_buf.getBuffer()[0].attr.bit.char_width == 2 );
+
+  // Long strings are not cached, but give the same result
+  const finalcut::FString long_text(300, L'x');
+  vterm_buf.clear();
+  vterm_buf.print(long_text);
+  vterm_buf.print(long_text);
+  CPPUNIT_ASSERT ( vterm_buf.getLength() == 600 );
+  CPPUNIT_ASSERT ( vterm_buf.toString() == long_text + long_text );
+
+  // The cache keeps its own copy of a printed string
+  vterm_buf.clear();
+
+  {
+    finalcut::FString temp_label{L"Cancel"};
+    vterm_buf.print(temp_label);
+    temp_label = L"Change";
+  }
+
+  vterm_buf.print(L"Cancel");
+  CPPUNIT_ASSERT ( vterm_buf.toString() == L"CancelCancel" );
+
+  // Evicted entries are shaped again
+  vterm_buf.clear();
+
+  for (int i{0}; i < 300; i++)
+    vterm_buf.print(finalcut::FString() << i);
+
+  vterm_buf.clear();
+  vterm_buf.print(L"0");
+  vterm_buf.print(L"299");
+  vterm_buf.print(label);
+  CPPUNIT_ASSERT ( vterm_buf.toString() == L"0299" + label );
+}
+
 
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FVTermBufferTest);
@@ -20,7 +20,12 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <sys/select.h>
+
+#include <clocale>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -391,6 +396,9 @@ class FWidgetTest : public CPPUNIT_NS::TestFixture
     void closeWidgetTest();
     void adjustSizeTest();
     void callbackTest();
+    void updateBatchTest();
+    void scrollViewTilesTest();
+    void scrollViewWideCharTest();
 
   private:
     class FSystemTest;
@@ -409,6 +417,9 @@ class FWidgetTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (closeWidgetTest);
     CPPUNIT_TEST (adjustSizeTest);
     CPPUNIT_TEST (callbackTest);
+    CPPUNIT_TEST (updateBatchTest);
+    CPPUNIT_TEST (scrollViewTilesTest);
+    CPPUNIT_TEST (scrollViewWideCharTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -478,6 +489,17 @@ class FWidgetTest::FSystemTest : public finalcut::FSystem
       return 0;
     }
 
+    auto write (int fd, const void* buf, std::size_t count) -> ssize_t override
+    {
+      return ::write(fd, buf, count);
+    }
+
+    auto select ( int nfds, fd_set* readfds, fd_set* writefds
+                , fd_set* exceptfds, struct timeval* timeout ) -> int override
+    {
+      return ::select(nfds, readfds, writefds, exceptfds, timeout);
+    }
+
     auto fopen (const char*, const char*) -> FILE* override
     {
       return nullptr;
@@ -536,6 +558,28 @@ class FWidgetTest::FSystemTest : public finalcut::FSystem
       return 0;
     }
 
+    auto timerfd_create (int, int) -> int override
+    {
+      return -1;
+    }
+
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override
+    {
+      return 0;
+    }
+
+    auto signalfd (int, const sigset_t*, int) -> int override
+    {
+      return -1;
+    }
+
+    auto pthread_sigmask (int, const sigset_t*, sigset_t*) -> int override
+    {
+      return 0;
+    }
+
     auto getuid() -> uid_t override
     {
       return 0;
@@ -2932,6 +2976,354 @@ void FWidgetTest::callbackTest()
   CPPUNIT_ASSERT ( value == 302 );
 }
 
+//----------------------------------------------------------------------
+void FWidgetTest::updateBatchTest()
+{
+  class TestWidget : public finalcut::FWidget
+  {
+    public:
+      explicit TestWidget (finalcut::FWidget* parent = nullptr)
+        : finalcut::FWidget{parent}
+      { }
+
+      TestWidget (const TestWidget&) = delete;
+
+      TestWidget (TestWidget&&) noexcept = delete;
+
+      ~TestWidget() override
+      { }
+
+      void flushChanges() override
+      {
+        flush_count++;
+      }
+
+      auto getUpdateArea() -> FTermArea*
+      {
+        return getPrintArea();
+      }
+
+      int draw_count{0};
+      int flush_count{0};
+
+    private:
+      void draw() override
+      {
+        draw_count++;
+      }
+  };
+
+  finalcut::FWidget root_wdgt{};  // Root widget
+  TestWidget wdgt{&root_wdgt};
+  TestWidget child_wdgt{&wdgt};
+  wdgt.setFlags().visibility.shown = true;
+  child_wdgt.setFlags().visibility.shown = true;
+  CPPUNIT_ASSERT ( ! wdgt.isUpdating() );
+  CPPUNIT_ASSERT ( ! child_wdgt.isUpdating() );
+
+  // Without an update batch
+  child_wdgt.redraw();
+  CPPUNIT_ASSERT ( child_wdgt.draw_count == 1 );
+  wdgt.redraw();
+  CPPUNIT_ASSERT ( wdgt.draw_count == 1 );
+  CPPUNIT_ASSERT ( child_wdgt.draw_count == 2 );
+
+  {
+    finalcut::FUpdateGuard guard{wdgt};
+    CPPUNIT_ASSERT ( wdgt.isUpdating() );
+    CPPUNIT_ASSERT ( child_wdgt.isUpdating() );
+    CPPUNIT_ASSERT ( ! root_wdgt.isUpdating() );
+
+    {
+      finalcut::FUpdateGuard inner_guard{child_wdgt};  // Nested batch
+
+      for (int i{0}; i < 10; i++)
+        child_wdgt.redraw();
+    }
+
+    // The outer batch is still open
+    CPPUNIT_ASSERT ( child_wdgt.isUpdating() );
+    CPPUNIT_ASSERT ( child_wdgt.draw_count == 2 );
+    CPPUNIT_ASSERT ( child_wdgt.flush_count == 0 );
+
+    for (int i{0}; i < 10; i++)
+    {
+      wdgt.redraw();
+      child_wdgt.redraw();
+    }
+
+    CPPUNIT_ASSERT ( wdgt.draw_count == 1 );
+    CPPUNIT_ASSERT ( child_wdgt.draw_count == 2 );
+  }
+
+  // One merged redraw and one flush per widget
+  CPPUNIT_ASSERT ( ! wdgt.isUpdating() );
+  CPPUNIT_ASSERT ( ! child_wdgt.isUpdating() );
+  CPPUNIT_ASSERT ( wdgt.draw_count == 2 );
+  CPPUNIT_ASSERT ( child_wdgt.draw_count == 3 );
+  CPPUNIT_ASSERT ( wdgt.flush_count == 1 );
+  CPPUNIT_ASSERT ( child_wdgt.flush_count == 1 );
+
+  // An unbalanced endUpdate() call is ignored
+  wdgt.endUpdate();
+  CPPUNIT_ASSERT ( ! wdgt.isUpdating() );
+  CPPUNIT_ASSERT ( wdgt.draw_count == 2 );
+  CPPUNIT_ASSERT ( wdgt.flush_count == 1 );
+
+  // A batch without changes does not redraw
+  wdgt.beginUpdate();
+  wdgt.endUpdate();
+  CPPUNIT_ASSERT ( wdgt.draw_count == 2 );
+  CPPUNIT_ASSERT ( wdgt.flush_count == 2 );
+
+  // Destroying a widget with an open batch releases the print area
+  auto temp_wdgt = std::make_unique<TestWidget>(&root_wdgt);
+  auto area = temp_wdgt->getUpdateArea();
+  CPPUNIT_ASSERT ( area != nullptr );
+  CPPUNIT_ASSERT ( area->update_locks == 0 );
+  temp_wdgt->beginUpdate();
+  temp_wdgt->beginUpdate();
+  CPPUNIT_ASSERT ( area->update_locks == 1 );
+  temp_wdgt.reset();
+  CPPUNIT_ASSERT ( area->update_locks == 0 );
+}
+
+//----------------------------------------------------------------------
+namespace test
+{
+
+class ScrollView : public finalcut::FScrollView
+{
+  public:
+    explicit ScrollView (finalcut::FWidget* parent)
+      : finalcut::FScrollView{parent}
+    {
+      setFlags().visibility.shown = true;
+      setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{22, 12});
+    }
+
+    ~ScrollView() override
+    {
+      setPrintArea (nullptr);
+    }
+
+    void copyViewport()
+    {
+      // Copies the viewport into a print area of the parent widget
+      // (there is no window area without an application)
+      if ( ! print_area )
+      {
+        print_area = createArea(finalcut::FRect{0, 0, 40, 20});
+        print_area->setOwner<finalcut::FVTerm*>(getParentWidget());
+      }
+
+      setPrintArea (print_area.get());
+      copy2area();
+    }
+
+    auto getViewport() const -> FTermArea*
+    {
+      return getChildPrintArea();
+    }
+
+    auto getViewportChar (int x, int y) -> const finalcut::FChar&
+    {
+      // Returns the copied character at viewport position x, y
+      return print_area->getFChar(getX() + x, getY() + y);
+    }
+
+  private:
+    std::unique_ptr<FTermArea> print_area{};
+};
+
+struct TileCall
+{
+  finalcut::FPoint pos;
+  std::size_t      width;
+};
+
+}  // namespace test
+
+//----------------------------------------------------------------------
+void FWidgetTest::scrollViewTilesTest()
+{
+  std::unique_ptr<finalcut::FSystem> fsys = std::make_unique<FSystemTest>();
+  finalcut::FTerm::setFSystem(fsys);
+
+  finalcut::FWidget root_wdgt{};
+  test::ScrollView scroll_view{&root_wdgt};
+  std::vector<test::TileCall> calls{};
+  scroll_view.setScrollSize (finalcut::FSize{1000, 400});
+  CPPUNIT_ASSERT ( ! scroll_view.isVirtualized() );
+  CPPUNIT_ASSERT ( scroll_view.getViewport()->size.width == 1000 );
+  CPPUNIT_ASSERT ( scroll_view.getViewport()->size.height == 400 );
+
+  // Each column shows a letter for its scroll column
+  scroll_view.setTilePainter
+  (
+    [&calls] ( finalcut::FVTermBuffer& line
+             , const finalcut::FPoint& pos
+             , std::size_t width )
+    {
+      calls.push_back({pos, width});
+      finalcut::FString text{};
+
+      for (std::size_t i{0}; i < width; i++)
+        text += wchar_t(L'a' + (pos.getX() - 1 + int(i)) % 26);
+
+      line.print(text);
+    }
+  );
+
+  // The whole scroll content is no longer kept in the viewport
+  CPPUNIT_ASSERT ( scroll_view.isVirtualized() );
+  CPPUNIT_ASSERT ( scroll_view.getViewport()->size.width == 1 );
+  CPPUNIT_ASSERT ( scroll_view.getViewport()->size.height == 1 );
+  CPPUNIT_ASSERT ( calls.empty() );
+
+  // Only the tile of the visible region is painted on demand
+  const auto width = int(scroll_view.getViewportWidth());
+  const auto height = int(scroll_view.getViewportHeight());
+  CPPUNIT_ASSERT ( width < 64 );
+  CPPUNIT_ASSERT ( height < 16 );
+  scroll_view.copyViewport();
+  CPPUNIT_ASSERT ( calls.size() == 16 );  // One call per tile line
+  CPPUNIT_ASSERT ( calls[0].pos == finalcut::FPoint(1, 1) );
+  CPPUNIT_ASSERT ( calls[0].width == 65 );  // Tile plus one column
+  CPPUNIT_ASSERT ( calls[15].pos == finalcut::FPoint(1, 16) );
+
+  for (auto y{0}; y < height; y++)
+    for (auto x{0}; x < width; x++)
+      CPPUNIT_ASSERT ( scroll_view.getViewportChar(x, y).ch[0]
+                       == wchar_t(L'a' + x % 26) );
+
+  // Crossing the tile edge paints the neighboring tile. It starts
+  // one column before its first column and ends one column after it
+  calls.clear();
+  scroll_view.scrollTo (51, 1);
+  CPPUNIT_ASSERT ( calls.size() == 16 );
+  CPPUNIT_ASSERT ( calls[0].pos == finalcut::FPoint(64, 1) );
+  CPPUNIT_ASSERT ( calls[0].width == 66 );
+
+  for (auto x{0}; x < width; x++)
+    CPPUNIT_ASSERT ( scroll_view.getViewportChar(x, 0).ch[0]
+                     == wchar_t(L'a' + (50 + x) % 26) );
+
+  // Cached tiles are not painted again
+  calls.clear();
+  scroll_view.scrollTo (1, 1);
+  scroll_view.scrollTo (51, 1);
+  CPPUNIT_ASSERT ( calls.empty() );
+
+  // The least recently used tile is replaced when the cache is full
+  // (16 tiles for this viewport size)
+  for (auto row{1}; row < 16; row++)
+    scroll_view.scrollTo (1, 1 + row * 16);
+
+  calls.clear();
+  scroll_view.scrollTo (1, 1 + 16 * 16);  // Replaces tile (0, 0)
+  CPPUNIT_ASSERT ( calls.size() == 16 );
+  calls.clear();
+  scroll_view.scrollTo (1, 1 + 15 * 16);  // Still cached
+  CPPUNIT_ASSERT ( calls.empty() );
+  scroll_view.scrollTo (1, 1);  // Painted again
+  CPPUNIT_ASSERT ( calls.size() == 16 );
+  CPPUNIT_ASSERT ( calls[0].pos == finalcut::FPoint(1, 1) );
+
+  // invalidateTiles() paints the visible tiles again
+  calls.clear();
+  scroll_view.copyViewport();
+  CPPUNIT_ASSERT ( calls.empty() );  // No changes
+  scroll_view.invalidateTiles();
+  scroll_view.copyViewport();
+  CPPUNIT_ASSERT ( calls.size() == 16 );
+  CPPUNIT_ASSERT ( calls[0].pos == finalcut::FPoint(1, 1) );
+
+  // unsetTilePainter() restores the full-size viewport
+  calls.clear();
+  scroll_view.unsetTilePainter();
+  CPPUNIT_ASSERT ( ! scroll_view.isVirtualized() );
+  CPPUNIT_ASSERT ( scroll_view.getViewport()->size.width == 1000 );
+  CPPUNIT_ASSERT ( scroll_view.getViewport()->size.height == 400 );
+  scroll_view.copyViewport();
+  CPPUNIT_ASSERT ( calls.empty() );
+  CPPUNIT_ASSERT ( scroll_view.getViewportChar(0, 0).ch[0] == L' ' );
+}
+
+//----------------------------------------------------------------------
+void FWidgetTest::scrollViewWideCharTest()
+{
+  std::unique_ptr<finalcut::FSystem> fsys = std::make_unique<FSystemTest>();
+  finalcut::FTerm::setFSystem(fsys);
+
+  finalcut::FWidget root_wdgt{};
+  test::ScrollView scroll_view{&root_wdgt};
+  scroll_view.setScrollSize (finalcut::FSize{200, 20});
+
+  // The column width of full-width characters requires UTF-8
+  auto& fterm_data = finalcut::FTermData::getInstance();
+  const auto saved_encoding = fterm_data.getTerminalEncoding();
+  const std::string saved_locale{std::setlocale(LC_CTYPE, nullptr)};
+  fterm_data.setTermEncoding (finalcut::Encoding::UTF8);
+
+  if ( ! std::setlocale(LC_CTYPE, "en_US.UTF-8")
+    && ! std::setlocale(LC_CTYPE, "C.UTF-8") )
+  {
+    std::cerr << "No UTF-8 character set found!";
+    fterm_data.setTermEncoding (saved_encoding);
+    return;
+  }
+
+  // A full-width character in the last column of the first tile
+  scroll_view.setTilePainter
+  (
+    [] ( finalcut::FVTermBuffer& line
+       , const finalcut::FPoint& pos
+       , std::size_t width )
+    {
+      finalcut::FString text{};
+      int column = pos.getX() - 1;
+      const int end = column + int(width);
+
+      while ( column < end )
+      {
+        if ( column == 63 && column + 1 < end )
+        {
+          text += L'\U0000ff37';  // Fullwidth Latin Capital Letter W
+          column += 2;
+        }
+        else if ( column == 64 )
+        {
+          text += L'|';  // Line starts in the full-width character
+          column++;
+        }
+        else
+        {
+          text += L'-';
+          column++;
+        }
+      }
+
+      line.print(text);
+    }
+  );
+
+  // The character crosses the edge between tile 0 and tile 1
+  scroll_view.copyViewport();
+  scroll_view.scrollTo (61, 1);
+  const auto& left_half = scroll_view.getViewportChar(63 - 60, 0);
+  const auto& right_half = scroll_view.getViewportChar(64 - 60, 0);
+  CPPUNIT_ASSERT ( scroll_view.getViewportChar(62 - 60, 0).ch[0] == L'-' );
+  CPPUNIT_ASSERT ( left_half.ch[0] == L'\U0000ff37' );
+  CPPUNIT_ASSERT ( left_half.attr.bit.char_width == 2 );
+  // The padding character depends on the terminal encoding
+  CPPUNIT_ASSERT ( right_half.attr.bit.fullwidth_padding
+                || right_half.ch[0] == L'.' );
+  CPPUNIT_ASSERT ( scroll_view.getViewportChar(65 - 60, 0).ch[0] == L'-' );
+  std::setlocale(LC_CTYPE, saved_locale.c_str());
+  fterm_data.setTermEncoding (saved_encoding);
+}
+
 
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FWidgetTest);